@@ -0,0 +1,15 @@
+$input v_coordinates, v_dimensions, v_shader_values, v_position, v_gradient_pos, v_gradient_pos2, v_gradient_texture_pos
+
+#include <shader_include.sh>
+
+SAMPLER2D(s_gradient, 0);
+
+// Gaussian beam splat. One quad per substep, all batched into a single draw.
+// v_coordinates spans -1 to 1 across the quad; the profile reaches ~2% at the
+// edge and is faded to exactly zero so neighbouring quads don't show seams.
+void main() {
+  float r2 = dot(v_coordinates, v_coordinates);
+  float falloff = exp(-4.0 * r2) * (1.0 - smoothstep(0.8, 1.0, r2));
+  vec4 color = gradient(s_gradient, v_gradient_texture_pos, v_gradient_pos, v_gradient_pos2, v_position);
+  gl_FragColor = vec4(color.rgb, color.a * falloff);
+}
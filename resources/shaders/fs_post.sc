@@ -0,0 +1,233 @@
+$input v_texture_uv
+
+#include <shader_include.sh>
+
+SAMPLER2D(s_texture, 0);
+
+uniform vec4 u_time;
+uniform vec4 u_atlas_scale;
+uniform vec4 u_texture_clamp;
+uniform vec4 u_dimensions;
+uniform vec4 u_crt_params;   // x: CRT intensity (0-1 ensemble), yzw: unused
+uniform vec4 u_post_params;  // x: glitch, y: warp, z: sepia, w: gray scale
+
+// Fused post pass: CRT, glitch, warp, sepia and gray scale in one full-screen
+// read and write. Stages run in the order their separate shaders would have
+// been chained: geometry first (warp, jitter, curvature), then one fetch per
+// channel carrying chromatic aberration and glitch offsets together, then
+// colour grading and the CRT screen (scanlines, vignette, grain). Every stage
+// sits behind a uniform branch, so stages at zero intensity cost nothing.
+//
+// CRT intensity controls how many effects are applied:
+// 0.0 = no effect (passthrough)
+// 0.0-0.25: subtle scanlines only
+// 0.25-0.5: scanlines + light chromatic aberration + subtle jitter
+// 0.5-0.75: scanlines + chromatic aberration + curvature + jitter
+// 0.75-1.0: full CRT (all above + vignette + noise + stronger jitter)
+
+// Hash function for pseudo-random values
+float hash(float n) {
+  return fract(sin(n) * 43758.5453123);
+}
+
+float random(vec2 uv) {
+  return fract(sin(dot(uv, vec2(12.9898, 78.233))) * 43758.5453);
+}
+
+// Smooth noise for jitter
+float smoothNoise(float x) {
+  float i = floor(x);
+  float f = fract(x);
+  return mix(hash(i), hash(i + 1.0), f * f * (3.0 - 2.0 * f));
+}
+
+float noise(vec2 uv) {
+  vec2 i = floor(uv);
+  vec2 f = fract(uv);
+  float a = random(i);
+  float b = random(i + vec2(1.0, 0.0));
+  float c = random(i + vec2(0.0, 1.0));
+  float d = random(i + vec2(1.0, 1.0));
+  vec2 u = f * f * (3.0 - 2.0 * f);
+  return mix(a, b, u.x) + (c - a) * u.y * (1.0 - u.x) + (d - b) * u.x * u.y;
+}
+
+vec3 hsvToRgb(vec3 c) {
+  vec4 k = vec4(1.0, 2.0 / 3.0, 1.0 / 3.0, 3.0);
+  vec3 p = abs(fract(c.xxx + k.xyz) * 6.0 - k.www);
+  return c.z * mix(k.xxx, clamp(p - k.xxx, 0.0, 1.0), c.y);
+}
+
+vec2 curveUV(vec2 uv, float curvature) {
+  // Convert to centered coordinates
+  vec2 centered = uv * 2.0 - 1.0;
+
+  // Apply barrel distortion
+  float r2 = dot(centered, centered);
+  centered *= 1.0 + curvature * r2;
+
+  // Convert back
+  return centered * 0.5 + 0.5;
+}
+
+// Horizontal jitter - displaces each scanline horizontally based on time and position
+float horizontalJitter(float y, float timeVal, float jitterStrength) {
+  // Multiple frequency components for organic feel
+  float slowWave = smoothNoise(y * 3.0 + timeVal * 0.5) - 0.5;
+  float fastWave = smoothNoise(y * 20.0 + timeVal * 8.0) - 0.5;
+
+  // Occasional larger glitches (rare events)
+  float glitchTrigger = smoothNoise(y * 0.5 + timeVal * 2.0);
+  float glitch = glitchTrigger > 0.92 ? (hash(y + timeVal) - 0.5) * 4.0 : 0.0;
+
+  // Combine: slow drift + fast jitter + occasional glitch
+  return (slowWave * 0.3 + fastWave * 0.7 + glitch) * jitterStrength;
+}
+
+// Per-channel horizontal tearing (blocky bands plus slow wobble)
+vec3 glitchOffsets(vec2 uv, float time) {
+  vec2 value = vec2(uv.y, time + 150.9);
+  float random_size = random(floor(value * vec2(5.0, 0.1)));
+  float random_off = random(floor(value * vec2(25.0 * random_size + 5.0, 3.0)));
+  float offset = random(floor(value * vec2(0.2 * mod(random_off, 1.0), random_off)));
+  offset = floor(offset * 1.05);
+  vec3 bands = vec3(offset, offset, offset) * 0.018 *
+               vec3(random(floor(value * vec2(15.0, 5.0))),
+                    random(floor(value * vec2(17.0, 5.0))),
+                    random(floor(value * vec2(19.0, 5.0))));
+
+  vec3 wobble;
+  wobble.r = pow((noise(uv * vec2(0.0, 3.0) + time * 0.250100001 + 5.0) - 0.5) * 0.8, 5.0);
+  wobble.g = pow((noise(uv * vec2(0.0, 3.0) + time * 0.2509999888 + 4.0) - 0.5) * 0.8, 5.0);
+  wobble.b = pow((noise(uv * vec2(0.0, 3.0) + time * 0.25) - 0.5) * 0.8, 5.0);
+  return bands + wobble;
+}
+
+float scanline(vec2 uv, float count, float intensity) {
+  // Create horizontal scanlines
+  float scanVal = sin(uv.y * count * kPi * 2.0);
+  scanVal = scanVal * 0.5 + 0.5;  // 0-1 range
+
+  // Add subtle flicker based on time for analog feel
+  float flicker = 1.0 + 0.01 * sin(u_time.x * 8.0);
+
+  // Mix between full brightness and scanline darkness
+  return mix(1.0, 0.7 + 0.3 * scanVal, intensity) * flicker;
+}
+
+float vignette(vec2 uv, float intensity) {
+  vec2 centered = uv - 0.5;
+  float dist = length(centered) * 1.41421356;  // Normalize to corner = 1
+  float vig = 1.0 - dist * dist * intensity;
+  return clamp(vig, 0.0, 1.0);
+}
+
+float grainNoise(vec2 uv) {
+  return fract(sin(dot(uv, vec2(12.9898, 78.233)) + u_time.x * 0.1) * 43758.5453);
+}
+
+vec4 clampedSample(vec2 uv) {
+  return texture2D(s_texture, clamp(uv, u_texture_clamp.xy, u_texture_clamp.zw));
+}
+
+void main() {
+  float intensity = u_crt_params.x;
+  float glitch = u_post_params.x;
+  float warp = u_post_params.y;
+  float sepia = u_post_params.z;
+  float gray = u_post_params.w;
+
+  vec2 uv = v_texture_uv;
+
+  // CRT effect strengths: each fades in at a different range
+  float scanline_strength = smoothstep(0.0, 0.3, intensity);
+  float chroma_strength = smoothstep(0.15, 0.5, intensity) * 0.015;
+  float jitter_strength = smoothstep(0.2, 0.6, intensity) * 0.008;  // Subtle jitter starts early
+  float curve_strength = smoothstep(0.4, 0.75, intensity) * 0.08;
+  float vignette_strength = smoothstep(0.5, 0.9, intensity) * 0.4;
+  float noise_strength = smoothstep(0.7, 1.0, intensity) * 0.02;
+
+  // At very high intensity, increase jitter for more glitchy look
+  jitter_strength += smoothstep(0.8, 1.0, intensity) * 0.015;
+
+  // Warp: sinusoidal displacement in frame coordinates (centered, 0-1 span)
+  vec2 warp_coordinates = vec2(0.0, 0.0);
+  if (warp > 0.001) {
+    vec2 origin = u_texture_clamp.xy;
+    vec2 span = u_texture_clamp.zw - u_texture_clamp.xy;
+    warp_coordinates = (uv - origin) / span - 0.5;
+    warp_coordinates += warp * 0.01 * sin(u_time.x + warp_coordinates * 20.0);
+    uv = (warp_coordinates + 0.5) * span + origin;
+  }
+
+  // Apply horizontal jitter (per-scanline displacement)
+  if (jitter_strength > 0.0001) {
+    float jitterOffset = horizontalJitter(uv.y * u_dimensions.y, u_time.x, jitter_strength);
+    uv.x += jitterOffset;
+  }
+
+  // Apply curvature distortion
+  if (curve_strength > 0.001) {
+    uv = curveUV(uv, curve_strength);
+
+    // Check if we're outside the valid texture area (black bars)
+    if (uv.x < u_texture_clamp.x || uv.x > u_texture_clamp.z ||
+        uv.y < u_texture_clamp.y || uv.y > u_texture_clamp.w) {
+      gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
+      return;
+    }
+  }
+
+  // One fetch per channel covers chromatic aberration and glitch together
+  vec3 color;
+  if (chroma_strength > 0.0001 || glitch > 0.001) {
+    vec2 centered = uv - 0.5;
+    vec2 chroma = centered * length(centered) * chroma_strength;
+    vec3 tear = vec3(0.0, 0.0, 0.0);
+    if (glitch > 0.001)
+      tear = glitchOffsets(v_texture_uv, u_time.x) * glitch;
+    color.r = clampedSample(uv + chroma + vec2(tear.r, 0.0)).r;
+    color.g = clampedSample(uv + vec2(tear.b, 0.0)).g;
+    color.b = clampedSample(uv - chroma + vec2(tear.g, 0.0)).b;
+  } else {
+    color = clampedSample(uv).rgb;
+  }
+
+  // Warp tints by angle around the center with a slowly turning rainbow
+  if (warp > 0.001) {
+    float hue = atan2(warp_coordinates.y, warp_coordinates.x) / (2.0 * kPi) - u_time.x * 0.1;
+    color *= mix(vec3(1.0, 1.0, 1.0), hsvToRgb(vec3(hue, 1.0, 1.0)), warp);
+  }
+
+  // Colour grading
+  if (sepia > 0.001) {
+    vec3 toned = vec3(dot(color, vec3(0.393, 0.769, 0.189)),
+                      dot(color, vec3(0.349, 0.686, 0.168)),
+                      dot(color, vec3(0.272, 0.534, 0.131)));
+    color = mix(color, toned, sepia);
+  }
+  if (gray > 0.001) {
+    float luma = dot(color, vec3(0.299, 0.587, 0.114));
+    color = mix(color, vec3(luma, luma, luma), gray);
+  }
+
+  if (intensity > 0.001) {
+    // Apply scanlines - use screen pixel position for consistent line spacing
+    float scanline_count = u_dimensions.y * 0.5;  // One scanline per 2 pixels
+    color *= scanline(uv, scanline_count, scanline_strength * 0.5);
+
+    // Apply vignette
+    color *= vignette(uv, vignette_strength);
+
+    // Apply subtle noise/grain
+    if (noise_strength > 0.001) {
+      float n = grainNoise(uv * u_dimensions.xy) * 2.0 - 1.0;
+      color += n * noise_strength;
+    }
+  }
+
+  // Apply color multiplier
+  color *= u_color_mult.rgb;
+
+  gl_FragColor = vec4(color, 1.0);
+}
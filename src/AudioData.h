@@ -0,0 +1,498 @@
+#pragma once
+
+#include "AudioDecoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Memory-mapped WAV source
+// Opening a file only parses its header and maps it; PCM is decoded on demand
+// in blocks by read(). Pages fault in as playback reaches them and, being clean
+// file-backed memory, can be dropped by the OS at any time, so resident memory
+// stays bounded however long the file is.
+// Falls back to reading the file into memory where mapping is unavailable.
+//
+// Compressed files (see AudioDecoder) decode on a background thread into a
+// buffer allocated for the whole length, block by block, and are read like a
+// float WAV. Playback starts at once: frames the decoder has not reached yet
+// read as silence, and framesReady() tells the UI how far it has got. That
+// buffer is not file-backed, so a file whose decoded size exceeds
+// kMaxDecodedBytes, or that cannot be allocated, fails to load.
+class AudioData {
+public:
+  AudioData() = default;
+  ~AudioData() { close(); }
+
+  AudioData(const AudioData &) = delete;
+  AudioData &operator=(const AudioData &) = delete;
+
+  bool load(const std::string &path) {
+    close();
+    return open(path) || openDecoded(path);
+  }
+
+  void close() {
+    cancel_decode_ = true;
+    if (decode_thread_.joinable())
+      decode_thread_.join();
+    cancel_decode_ = false;
+    decoded_.reset();
+    decoded_frames_ = 0;
+#if defined(_WIN32)
+    if (view_)
+      UnmapViewOfFile(view_);
+    if (mapping_)
+      CloseHandle(mapping_);
+    view_ = nullptr;
+    mapping_ = nullptr;
+#else
+    if (map_base_)
+      munmap(map_base_, map_size_);
+    map_base_ = nullptr;
+    map_size_ = 0;
+#endif
+    fallback_.clear();
+    fallback_.shrink_to_fit();
+    file_ = nullptr;
+    data_ = nullptr;
+    num_frames_ = 0;
+    sample_rate_ = 44100;
+    num_channels_ = 0;
+  }
+
+  bool empty() const { return num_frames_ == 0; }
+  size_t numFrames() const { return num_frames_; }
+  int sampleRate() const { return sample_rate_; }
+  int numChannels() const { return num_channels_; }
+
+  // Frames from the start that can be read; all of them unless still decoding
+  size_t framesReady() const {
+    return decoded_ ? decoded_frames_.load(std::memory_order_acquire)
+                    : num_frames_;
+  }
+
+  // Decode num_frames frames starting at frame start into left/right, wrapping
+  // at the end of the file. Mono files are duplicated to both channels; files
+  // with more than two channels play their first two.
+  void read(size_t start, float *left, float *right, int num_frames) const {
+    if (num_frames_ == 0) {
+      std::fill(left, left + num_frames, 0.0f);
+      std::fill(right, right + num_frames, 0.0f);
+      return;
+    }
+
+    const size_t ready = framesReady();
+    size_t pos = start % num_frames_;
+    while (num_frames > 0) {
+      int count = static_cast<int>(
+          std::min<size_t>(num_frames, num_frames_ - pos));
+      const int n = readable(pos, count, ready);
+      decode(pos, left, right, n);
+      std::fill(left + n, left + count, 0.0f);
+      std::fill(right + n, right + count, 0.0f);
+      left += count;
+      right += count;
+      num_frames -= count;
+      pos = 0;
+    }
+  }
+
+  // Decode the given file channels into one buffer each (structure of arrays),
+  // wrapping like read(). Each channel is a strided walk over the same frames,
+  // which are in cache after the first. Channels the file does not have read as
+  // silence.
+  void readChannels(size_t start, const int *channels, float *const *out,
+                    int num_out, int num_frames) const {
+    if (num_frames_ == 0) {
+      for (int c = 0; c < num_out; ++c)
+        std::fill(out[c], out[c] + num_frames, 0.0f);
+      return;
+    }
+
+    const size_t ready = framesReady();
+    size_t pos = start % num_frames_;
+    int done = 0;
+    while (done < num_frames) {
+      int count = static_cast<int>(
+          std::min<size_t>(num_frames - done, num_frames_ - pos));
+      const int n = readable(pos, count, ready);
+      decodeChannels(pos, channels, out, num_out, done, n);
+      for (int c = 0; c < num_out; ++c)
+        std::fill(out[c] + done + n, out[c] + done + count, 0.0f);
+      done += count;
+      pos = 0;
+    }
+  }
+
+  // Hint that frames [start, start + num_frames) will be read soon, so the
+  // pages are fetched asynchronously instead of faulting in on the audio
+  // thread
+  void prefetch(size_t start, size_t num_frames) const {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if (!map_base_ || num_frames_ == 0)
+      return;
+    start %= num_frames_;
+    num_frames = std::min(num_frames, num_frames_ - start);
+
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t begin = (data_ - file_) + start * block_align_;
+    size_t end = begin + num_frames * block_align_;
+    begin -= begin % page;
+    madvise(map_base_ + begin, end - begin, MADV_WILLNEED);
+#else
+    (void)start;
+    (void)num_frames;
+#endif
+  }
+
+private:
+  enum class Format { Pcm16, Pcm24, Pcm32, Float32 };
+
+  static constexpr size_t kDecodeBlock = 16384; // Frames published at a time
+  // Decoded float PCM held in memory: stereo 44.1 kHz runs about 1.27 GiB an
+  // hour, so roughly 48 minutes on desktop and 12 in the browser
+#if defined(__EMSCRIPTEN__)
+  static constexpr uint64_t kMaxDecodedBytes = uint64_t{256} << 20;
+#else
+  static constexpr uint64_t kMaxDecodedBytes = uint64_t{1} << 30;
+#endif
+
+  // Of count frames from frame, how many are decoded
+  static int readable(size_t frame, int count, size_t ready) {
+    return static_cast<int>(
+        std::min<size_t>(count, ready > frame ? ready - frame : 0));
+  }
+
+  bool openDecoded(const std::string &path) {
+    std::unique_ptr<AudioDecoder> decoder = AudioDecoder::open(path);
+    if (!decoder)
+      return false;
+
+    const uint64_t frames = decoder->numFrames();
+    const int channels = decoder->numChannels();
+    if (frames > kMaxDecodedBytes / (sizeof(float) * channels)) {
+      std::fprintf(stderr,
+                   "faveworm: %s decodes to %llu MiB, over the limit of "
+                   "%llu MiB\n",
+                   path.c_str(),
+                   static_cast<unsigned long long>(
+                       frames * sizeof(float) * channels >> 20),
+                   static_cast<unsigned long long>(kMaxDecodedBytes >> 20));
+      return false;
+    }
+    // Left uninitialized: nothing reads past framesReady()
+    decoded_.reset(new (std::nothrow) float[frames * channels]);
+    if (!decoded_) {
+      std::fprintf(stderr, "faveworm: no memory to decode %s\n",
+                   path.c_str());
+      return false;
+    }
+
+    num_channels_ = channels;
+    sample_rate_ = decoder->sampleRate();
+    num_frames_ = static_cast<size_t>(frames);
+    format_ = Format::Float32;
+    bytes_per_sample_ = sizeof(float);
+    block_align_ = bytes_per_sample_ * num_channels_;
+    data_ = reinterpret_cast<const uint8_t *>(decoded_.get());
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    decodeAll(*decoder); // No threads to decode on
+#else
+    decode_thread_ = std::thread(
+        [this, decoder = std::move(decoder)] { decodeAll(*decoder); });
+#endif
+    return true;
+  }
+
+  // Decode thread
+  void decodeAll(AudioDecoder &decoder) {
+    float *dst = decoded_.get();
+    size_t done = 0;
+    auto cancelled = [&] {
+      return cancel_decode_.load(std::memory_order_relaxed);
+    };
+    while (done < num_frames_ && !cancelled()) {
+      const size_t block = std::min(kDecodeBlock, num_frames_ - done);
+      const size_t n = decoder.decode(dst + done * num_channels_, block);
+      if (n == 0)
+        break;
+      done += n;
+      decoded_frames_.store(done, std::memory_order_release);
+    }
+    // A stream shorter than its header said ends in silence
+    if (done < num_frames_ && !cancelled()) {
+      std::fill(dst + done * num_channels_, dst + num_frames_ * num_channels_,
+                0.0f);
+      decoded_frames_.store(num_frames_, std::memory_order_release);
+    }
+  }
+
+  bool open(const std::string &path) {
+    size_t size = 0;
+    if (!map(path, size))
+      return false;
+    if (!parseHeader(size)) {
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  bool map(const std::string &path, size_t &size) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return false;
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+      mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping_)
+        view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+    }
+    CloseHandle(file);
+    if (view_) {
+      size = static_cast<size_t>(file_size.QuadPart);
+      file_ = static_cast<const uint8_t *>(view_);
+      return true;
+    }
+#elif !defined(__EMSCRIPTEN__)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void *base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                        MAP_PRIVATE, fd, 0);
+      if (base != MAP_FAILED) {
+        map_base_ = static_cast<uint8_t *>(base);
+        map_size_ = static_cast<size_t>(st.st_size);
+        madvise(map_base_, map_size_, MADV_SEQUENTIAL);
+      }
+    }
+    ::close(fd);
+    if (map_base_) {
+      size = map_size_;
+      file_ = map_base_;
+      return true;
+    }
+#endif
+    // No mapping (e.g. the browser's in-memory filesystem): read it whole
+    std::FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f)
+      return false;
+    std::fseek(f, 0, SEEK_END);
+    long length = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    if (length > 0) {
+      fallback_.resize(static_cast<size_t>(length));
+      if (std::fread(fallback_.data(), 1, fallback_.size(), f) !=
+          fallback_.size())
+        fallback_.clear();
+    }
+    std::fclose(f);
+    size = fallback_.size();
+    file_ = fallback_.data();
+    return size > 0;
+  }
+
+  static uint16_t u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+  static uint32_t u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  bool parseHeader(size_t size) {
+    if (size < 12 || std::memcmp(file_, "RIFF", 4) != 0 ||
+        std::memcmp(file_ + 8, "WAVE", 4) != 0)
+      return false;
+
+    uint16_t audio_format = 0, bits_per_sample = 0;
+    bool have_fmt = false;
+    size_t pos = 12;
+
+    while (pos + 8 <= size) {
+      const uint8_t *chunk = file_ + pos;
+      uint32_t chunk_size = u32(chunk + 4);
+      const uint8_t *body = chunk + 8;
+      size_t available = size - pos - 8;
+
+      if (std::memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16 &&
+          available >= 16) {
+        audio_format = u16(body);
+        num_channels_ = u16(body + 2);
+        sample_rate_ = static_cast<int>(u32(body + 4));
+        block_align_ = u16(body + 12);
+        bits_per_sample = u16(body + 14);
+        // WAVE_FORMAT_EXTENSIBLE: the real format leads the subformat GUID
+        if (audio_format == 0xFFFE && chunk_size >= 40 && available >= 40)
+          audio_format = u16(body + 24);
+        have_fmt = true;
+      } else if (std::memcmp(chunk, "data", 4) == 0 && have_fmt) {
+        if (!selectFormat(audio_format, bits_per_sample))
+          return false;
+        size_t bytes = std::min<size_t>(chunk_size, available);
+        data_ = body;
+        num_frames_ = bytes / block_align_;
+        return num_frames_ > 0;
+      }
+
+      // Chunks are word aligned
+      pos += 8 + static_cast<size_t>(chunk_size) + (chunk_size & 1);
+    }
+    return false;
+  }
+
+  bool selectFormat(uint16_t audio_format, uint16_t bits_per_sample) {
+    if (num_channels_ < 1 || sample_rate_ <= 0)
+      return false;
+    bytes_per_sample_ = bits_per_sample / 8;
+    if (block_align_ < bytes_per_sample_ * num_channels_)
+      block_align_ = bytes_per_sample_ * num_channels_;
+
+    if (audio_format == 3 && bits_per_sample == 32)
+      format_ = Format::Float32;
+    else if (audio_format == 1 && bits_per_sample == 16)
+      format_ = Format::Pcm16;
+    else if (audio_format == 1 && bits_per_sample == 24)
+      format_ = Format::Pcm24;
+    else if (audio_format == 1 && bits_per_sample == 32)
+      format_ = Format::Pcm32;
+    else
+      return false;
+    return true;
+  }
+
+  void decode(size_t frame, float *left, float *right, int count) const {
+    const uint8_t *p = data_ + frame * block_align_;
+    const size_t right_offset = num_channels_ > 1 ? bytes_per_sample_ : 0;
+    const size_t stride = block_align_;
+
+    switch (format_) {
+    case Format::Pcm16:
+      for (int i = 0; i < count; ++i, p += stride) {
+        left[i] = static_cast<int16_t>(u16(p)) / 32768.0f;
+        right[i] = static_cast<int16_t>(u16(p + right_offset)) / 32768.0f;
+      }
+      break;
+    case Format::Pcm24:
+      for (int i = 0; i < count; ++i, p += stride) {
+        left[i] = pcm24(p);
+        right[i] = pcm24(p + right_offset);
+      }
+      break;
+    case Format::Pcm32:
+      for (int i = 0; i < count; ++i, p += stride) {
+        left[i] = static_cast<int32_t>(u32(p)) / 2147483648.0f;
+        right[i] = static_cast<int32_t>(u32(p + right_offset)) / 2147483648.0f;
+      }
+      break;
+    case Format::Float32:
+      for (int i = 0; i < count; ++i, p += stride) {
+        std::memcpy(&left[i], p, 4);
+        std::memcpy(&right[i], p + right_offset, 4);
+      }
+      break;
+    }
+  }
+
+  template <typename Sample>
+  void decodeRows(const uint8_t *p, const int *channels, float *const *out,
+                  int num_out, int offset, int count, Sample sample) const {
+    for (int c = 0; c < num_out; ++c) {
+      float *dst = out[c] + offset;
+      if (channels[c] < 0 || channels[c] >= num_channels_) {
+        std::fill(dst, dst + count, 0.0f);
+        continue;
+      }
+      const uint8_t *src = p + channels[c] * bytes_per_sample_;
+      for (int i = 0; i < count; ++i, src += block_align_)
+        dst[i] = sample(src);
+    }
+  }
+
+  void decodeChannels(size_t frame, const int *channels, float *const *out,
+                      int num_out, int offset, int count) const {
+    const uint8_t *p = data_ + frame * block_align_;
+    switch (format_) {
+    case Format::Pcm16:
+      decodeRows(p, channels, out, num_out, offset, count,
+                 [](const uint8_t *s) {
+                   return static_cast<int16_t>(u16(s)) / 32768.0f;
+                 });
+      break;
+    case Format::Pcm24:
+      decodeRows(p, channels, out, num_out, offset, count, pcm24);
+      break;
+    case Format::Pcm32:
+      decodeRows(p, channels, out, num_out, offset, count,
+                 [](const uint8_t *s) {
+                   return static_cast<int32_t>(u32(s)) / 2147483648.0f;
+                 });
+      break;
+    case Format::Float32:
+      decodeRows(p, channels, out, num_out, offset, count,
+                 [](const uint8_t *s) {
+                   float v;
+                   std::memcpy(&v, s, 4);
+                   return v;
+                 });
+      break;
+    }
+  }
+
+  static float pcm24(const uint8_t *p) {
+    int32_t sample = static_cast<int32_t>((static_cast<uint32_t>(p[2]) << 24) |
+                                          (p[1] << 16) | (p[0] << 8));
+    return sample / 2147483648.0f;
+  }
+
+  // Whole file, mapped or read, and the PCM data within it
+  const uint8_t *file_ = nullptr;
+  const uint8_t *data_ = nullptr;
+  size_t num_frames_ = 0;
+  int sample_rate_ = 44100;
+  int num_channels_ = 0;
+  size_t block_align_ = 0;
+  size_t bytes_per_sample_ = 0;
+  Format format_ = Format::Pcm16;
+
+#if defined(_WIN32)
+  HANDLE mapping_ = nullptr;
+  void *view_ = nullptr;
+#else
+  uint8_t *map_base_ = nullptr;
+  size_t map_size_ = 0;
+#endif
+  std::vector<uint8_t> fallback_;
+
+  // Compressed sources: the decoded PCM and how much of it is ready
+  std::unique_ptr<float[]> decoded_;
+  std::atomic<size_t> decoded_frames_{0};
+  std::atomic<bool> cancel_decode_{false};
+  std::thread decode_thread_;
+};
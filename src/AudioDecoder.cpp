@@ -0,0 +1,164 @@
+#if FAVEWORM_DECODERS
+
+#include "AudioDecoder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#define DR_FLAC_IMPLEMENTATION
+#define DR_FLAC_NO_OGG
+#include <dr_flac.h>
+#define DR_MP3_IMPLEMENTATION
+#include <dr_mp3.h>
+// Declarations only here: the implementation, which defines short macros of
+// its own, is included at the end of the file
+#define STB_VORBIS_HEADER_ONLY
+#include <stb_vorbis.c>
+
+namespace {
+
+class FlacDecoder : public AudioDecoder {
+public:
+  bool open(const std::string &path) {
+    flac_ = drflac_open_file(path.c_str(), nullptr);
+    if (!flac_)
+      return false;
+    sample_rate_ = static_cast<int>(flac_->sampleRate);
+    num_channels_ = flac_->channels;
+    num_frames_ = flac_->totalPCMFrameCount; // 0 when the header leaves it out
+    return true;
+  }
+
+  ~FlacDecoder() override {
+    if (flac_)
+      drflac_close(flac_);
+  }
+
+  size_t decode(float *out, size_t max_frames) override {
+    return static_cast<size_t>(
+        drflac_read_pcm_frames_f32(flac_, max_frames, out));
+  }
+
+private:
+  drflac *flac_ = nullptr;
+};
+
+class Mp3Decoder : public AudioDecoder {
+public:
+  bool open(const std::string &path) {
+    if (!drmp3_init_file(&mp3_, path.c_str(), nullptr))
+      return false;
+    initialized_ = true;
+    sample_rate_ = static_cast<int>(mp3_.sampleRate);
+    num_channels_ = static_cast<int>(mp3_.channels);
+    // MP3 carries no reliable length: this walks the frames without synthesis
+    // and seeks back to the start
+    num_frames_ = drmp3_get_pcm_frame_count(&mp3_);
+    return true;
+  }
+
+  ~Mp3Decoder() override {
+    if (initialized_)
+      drmp3_uninit(&mp3_);
+  }
+
+  size_t decode(float *out, size_t max_frames) override {
+    return static_cast<size_t>(
+        drmp3_read_pcm_frames_f32(&mp3_, max_frames, out));
+  }
+
+private:
+  drmp3 mp3_;
+  bool initialized_ = false;
+};
+
+class VorbisDecoder : public AudioDecoder {
+public:
+  bool open(const std::string &path) {
+    int error = 0;
+    vorbis_ = stb_vorbis_open_filename(path.c_str(), &error, nullptr);
+    if (!vorbis_)
+      return false;
+    stb_vorbis_info info = stb_vorbis_get_info(vorbis_);
+    sample_rate_ = static_cast<int>(info.sample_rate);
+    num_channels_ = info.channels;
+    num_frames_ = stb_vorbis_stream_length_in_samples(vorbis_);
+    return true;
+  }
+
+  ~VorbisDecoder() override {
+    if (vorbis_)
+      stb_vorbis_close(vorbis_);
+  }
+
+  size_t decode(float *out, size_t max_frames) override {
+    size_t done = 0;
+    while (done < max_frames) {
+      const size_t floats = (max_frames - done) * num_channels_;
+      const int n = stb_vorbis_get_samples_float_interleaved(
+          vorbis_, num_channels_, out + done * num_channels_,
+          static_cast<int>(std::min<size_t>(floats, 1 << 20)));
+      if (n <= 0)
+        break;
+      done += static_cast<size_t>(n);
+    }
+    return done;
+  }
+
+private:
+  stb_vorbis *vorbis_ = nullptr;
+};
+
+enum class Container { Unknown, Flac, Ogg, Mp3 };
+
+// By signature rather than extension, so a misnamed file still opens
+Container sniff(const std::string &path) {
+  std::FILE *f = std::fopen(path.c_str(), "rb");
+  if (!f)
+    return Container::Unknown;
+  unsigned char magic[4] = {};
+  const size_t n = std::fread(magic, 1, sizeof(magic), f);
+  std::fclose(f);
+  if (n < sizeof(magic))
+    return Container::Unknown;
+
+  if (std::memcmp(magic, "fLaC", 4) == 0)
+    return Container::Flac;
+  if (std::memcmp(magic, "OggS", 4) == 0)
+    return Container::Ogg;
+  // An ID3v2 tag or a bare MPEG audio frame sync
+  if (std::memcmp(magic, "ID3", 3) == 0 ||
+      (magic[0] == 0xFF && (magic[1] & 0xE0) == 0xE0))
+    return Container::Mp3;
+  return Container::Unknown;
+}
+
+template <typename Decoder>
+std::unique_ptr<AudioDecoder> openAs(const std::string &path) {
+  auto decoder = std::make_unique<Decoder>();
+  if (!decoder->open(path) || decoder->numFrames() == 0 ||
+      decoder->numChannels() < 1 || decoder->sampleRate() <= 0)
+    return nullptr;
+  return decoder;
+}
+
+} // namespace
+
+std::unique_ptr<AudioDecoder> AudioDecoder::open(const std::string &path) {
+  switch (sniff(path)) {
+  case Container::Flac:
+    return openAs<FlacDecoder>(path);
+  case Container::Ogg:
+    return openAs<VorbisDecoder>(path);
+  case Container::Mp3:
+    return openAs<Mp3Decoder>(path);
+  default:
+    return nullptr;
+  }
+}
+
+#undef STB_VORBIS_HEADER_ONLY
+#include <stb_vorbis.c>
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Compressed audio file decoder (FLAC, MP3, Ogg Vorbis)
+// A decoder is opened on the UI thread, which learns the format and length up
+// front, then handed to AudioData's decode thread, which pulls blocks of
+// interleaved float frames from it while playback is already running.
+//
+// The decoders themselves (dr_flac, dr_mp3, stb_vorbis) are fetched by the app
+// build, which defines FAVEWORM_DECODERS; without it open() finds nothing and
+// only WAV loads.
+class AudioDecoder {
+public:
+  virtual ~AudioDecoder() = default;
+
+  // Null if path is not a format this build decodes, or its length is unknown
+  static std::unique_ptr<AudioDecoder> open(const std::string &path);
+
+  int sampleRate() const { return sample_rate_; }
+  int numChannels() const { return num_channels_; }
+  uint64_t numFrames() const { return num_frames_; }
+
+  // Decodes up to max_frames interleaved frames into out and returns how many
+  // it wrote; 0 at the end of the stream
+  virtual size_t decode(float *out, size_t max_frames) = 0;
+
+protected:
+  int sample_rate_ = 0;
+  int num_channels_ = 0;
+  uint64_t num_frames_ = 0;
+};
+
+#if !FAVEWORM_DECODERS
+inline std::unique_ptr<AudioDecoder> AudioDecoder::open(const std::string &) {
+  return nullptr;
+}
+#endif
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// One interpolated beam position, ready to be drawn as a Gaussian splat
+struct BeamSplat {
+  float x, y;      // Beam center in pixels
+  float intensity; // Deposited energy (0-1)
+  float hue;       // Whole degrees [0, 360), see BeamSplatter::kHueSteps
+};
+
+// Turns a sample path into the list of beam splats for one frame.
+// Splat generation is kept free of any Canvas calls so the whole frame can be
+// submitted to the GPU in one batch (and benchmarked without a window), and
+// so it can be split across threads (see setPool).
+//
+// Two interpolation modes:
+// - Substep: heuristic spacing (step_dist) with a per-segment clamp, the
+//   original faveworm look.
+// - Analytic: each sample pair is treated as a Gaussian beam moving at
+//   constant velocity. The exposure it leaves is the closed-form line
+//   integral E/L * G(u) * [Phi((L - t)/sigma) - Phi(-t/sigma)], which a
+//   midpoint sum of Gaussian splats spaced 2*sigma apart reproduces to within
+//   ~1.4% ripple (2 * exp(-pi^2 / 2)). Spacing s leaves 2 * exp(-2 pi^2
+//   sigma^2 / s^2) of the line's exposure as ripple, and a long segment's
+//   exposure is spread thin, so spacing widens per segment until the ripple
+//   would reach kRippleTolerance: fast, dim sweeps take a few splats instead
+//   of one per 2 sigma. Both modes share the kMaxSubsteps clamp, so neither
+//   depends on max_splats to stay bounded.
+class BeamSplatter {
+public:
+  static constexpr int kMaxSubsteps = 80; // Per-segment substep clamp
+  // Analytic: largest visible ripple along a line, in splat intensity
+  static constexpr float kRippleTolerance = 1.0f / 512.0f;
+
+  // Hue is rounded to whole degrees: finer steps are not visible, runs of
+  // segments then share one colour, and draw code can look colours up by hue
+  static constexpr int kHueSteps = 360;
+
+  enum class Mode { Substep, Analytic };
+
+  struct Params {
+    Mode mode = Mode::Substep;
+    float step_dist = 1.5f;    // Nominal pixel distance between substeps
+    float beam_sigma = 0.5f;   // Gaussian beam sigma in pixels (Analytic)
+    float unit_gain = 1.0f;    // Energy deposited per sample segment
+    float base_hue = 170.0f;   // Degrees
+    float hue_dynamics = 0.0f; // Velocity-based hue shift sensitivity
+    int max_splats = 100000;   // Budget; spacing widens instead of truncating
+  };
+
+  // Spreads generation over pool's threads; null (the default) runs serially.
+  // The output is identical either way.
+  void setPool(WorkerPool *pool) { pool_ = pool; }
+
+  // Generates splats for samples[0..num_samples). to_pixel maps a sample to
+  // pixel space and is called exactly once per sample, concurrently from
+  // several threads when a pool is set.
+  template <typename SampleT, typename ToPixel>
+  void generate(const SampleT *samples, int num_samples, ToPixel to_pixel,
+                const Params &params, std::vector<BeamSplat> &out) {
+    out.clear();
+    append(samples, num_samples, to_pixel, params, out);
+  }
+
+  // As generate, after what out already holds (several traces in one list)
+  template <typename SampleT, typename ToPixel>
+  void append(const SampleT *samples, int num_samples, ToPixel to_pixel,
+              const Params &params, std::vector<BeamSplat> &out) {
+    if (num_samples < 2)
+      return;
+
+    // Segments are split into contiguous chunks. Each pass runs chunks in
+    // parallel, and a prefix sum of per-chunk splat counts gives every chunk
+    // its own range of out, so the merge is free and keeps sample order.
+    const int num_segments = num_samples - 1;
+    int num_chunks = 1;
+    if (pool_)
+      num_chunks = std::max(1, std::min(pool_->concurrency() * kChunksPerThread,
+                                        num_segments / kMinChunkSegments));
+    auto chunkBegin = [&](int c) {
+      return static_cast<int>(static_cast<long>(num_segments) * c / num_chunks);
+    };
+    auto forEachChunk = [&](auto &&fn) {
+      auto task = [&](int c) { fn(c, chunkBegin(c), chunkBegin(c + 1)); };
+      if (num_chunks > 1)
+        pool_->parallelFor(num_chunks, task);
+      else
+        task(0);
+    };
+
+    pixels_.resize(num_samples);
+    lengths_.resize(num_segments);
+    counts_.resize(num_segments);
+    chunk_offsets_.assign(num_chunks + 1, 0);
+
+    const bool analytic = params.mode == Mode::Analytic;
+    const float sigma = std::max(params.beam_sigma, 0.05f);
+    const float inv_step = 1.0f / (analytic ? 2.0f * sigma : params.step_dist);
+    // Analytic: a segment of length d leaves a line of exposure A = gain *
+    // sqrt(2 pi) * sigma / d, and its spacing s is the widest that keeps the
+    // ripple 2 A exp(-2 pi^2 sigma^2 / s^2) under the tolerance, from 2 sigma
+    // up to kMaxSpacingSigmas
+    const float exposure = params.unit_gain * 2.5066283f * sigma;
+    auto segmentInvStep = [&](float d) {
+      if (!analytic)
+        return inv_step;
+      const float ratio = 2.0f * exposure / (kRippleTolerance * d);
+      if (ratio <= kMinRippleRatio)
+        return inv_step * 2.0f / kMaxSpacingSigmas;
+      return std::min(inv_step, std::sqrt(std::log(ratio) * 0.5f) *
+                                    (1.0f / (3.14159265f * sigma)));
+    };
+
+    // Pass 1: pixel positions, segment lengths and the substep count at
+    // nominal spacing. The last chunk also maps the final sample.
+    forEachChunk([&](int c, int begin, int end) {
+      const int last = c == num_chunks - 1 ? num_samples : end;
+      for (int i = begin; i < last; ++i) {
+        auto p = to_pixel(samples[i]);
+        pixels_[i] = {p.x, p.y};
+      }
+    });
+    forEachChunk([&](int c, int begin, int end) {
+      long count = 0;
+      for (int pos = begin; pos < end; ++pos) {
+        const float dx = pixels_[pos + 1].x - pixels_[pos].x;
+        const float dy = pixels_[pos + 1].y - pixels_[pos].y;
+        const float d = std::sqrt(dx * dx + dy * dy);
+        lengths_[pos] = d;
+        counts_[pos] = substeps(d, segmentInvStep(d));
+        count += counts_[pos];
+      }
+      chunk_offsets_[c + 1] = count;
+    });
+    long total = 1;
+    for (int c = 0; c < num_chunks; ++c)
+      total += chunk_offsets_[c + 1];
+
+    // Over budget: widen the spacing so the whole frame still renders, rather
+    // than cutting the beam off partway through. Rounding up adds at most one
+    // substep per segment, so that much headroom is kept back.
+    if (total > params.max_splats) {
+      const int headroom = std::max(params.max_splats - num_samples, 1);
+      const float inv_scale = headroom / static_cast<float>(total);
+      forEachChunk([&](int c, int begin, int end) {
+        long count = 0;
+        for (int pos = begin; pos < end; ++pos) {
+          const float d = lengths_[pos];
+          counts_[pos] = substeps(d, segmentInvStep(d) * inv_scale);
+          count += counts_[pos];
+        }
+        chunk_offsets_[c + 1] = count;
+      });
+    }
+
+    // Substep mode closes the beam with the final endpoint
+    if (!analytic)
+      ++chunk_offsets_[num_chunks];
+    for (int c = 0; c < num_chunks; ++c)
+      chunk_offsets_[c + 1] += chunk_offsets_[c];
+    const size_t base = out.size();
+    out.resize(base + chunk_offsets_[num_chunks]);
+
+    // Pass 2: interpolate substeps, each chunk into its own range
+    forEachChunk([&](int c, int begin, int end) {
+      BeamSplat *dst = out.data() + base + chunk_offsets_[c];
+      for (int pos = begin; pos < end; ++pos)
+        dst = interpolate(pos, pos == num_segments - 1, analytic, params, dst);
+    });
+  }
+
+private:
+  struct Point {
+    float x, y;
+  };
+
+  static constexpr int kMinChunkSegments = 128; // Below this, not worth a hop
+  static constexpr int kChunksPerThread = 4;    // Slack for load balancing
+  // Analytic spacing stops widening at this many sigmas: a line dimmer than
+  // kMinRippleRatio (exp(2 pi^2 / 4^2)) tolerances would go wider still, but
+  // its dots are below the tolerance anyway
+  static constexpr float kMaxSpacingSigmas = 4.0f;
+  static constexpr float kMinRippleRatio = 3.4339f;
+
+
+  static int substeps(float d, float inv_step) {
+    return std::min(kMaxSubsteps,
+                    std::max(static_cast<int>(std::ceil(d * inv_step)), 1));
+  }
+
+  // Writes the splats of segment pos and returns the end of what it wrote
+  BeamSplat *interpolate(int pos, bool last, bool analytic,
+                         const Params &params, BeamSplat *dst) const {
+    float x = pixels_[pos].x;
+    float y = pixels_[pos].y;
+    const float d = lengths_[pos];
+
+    const int n = counts_[pos];
+    const float nr = 1.0f / static_cast<float>(n);
+    const float ix = (pixels_[pos + 1].x - x) * nr;
+    const float iy = (pixels_[pos + 1].y - y) * nr;
+    const float g = params.unit_gain * nr;
+    int end = last ? n + 1 : n;
+
+    // Analytic: splats at sub-interval midpoints, so segment joints are not
+    // counted twice and no closing endpoint is needed
+    if (analytic) {
+      x += ix * 0.5f;
+      y += iy * 0.5f;
+      end = n;
+    }
+
+    // Velocity-based hue shift: faster beam motion shifts hue
+    float velocity = d * nr; // Instantaneous velocity per substep
+    float hue_shift =
+        velocity * params.hue_dynamics * 180.0f; // Scale for visible effect
+    int degrees =
+        static_cast<int>(std::lround(params.base_hue + hue_shift)) % kHueSteps;
+    if (degrees < 0)
+      degrees += kHueSteps;
+    const float hue = static_cast<float>(degrees);
+
+    const float brightness = std::min(1.0f, g);
+    for (int k = 0; k < end; ++k) {
+      *dst++ = {x, y, brightness, hue};
+      x += ix;
+      y += iy;
+    }
+    return dst;
+  }
+
+  WorkerPool *pool_ = nullptr;
+  std::vector<Point> pixels_;
+  std::vector<float> lengths_;
+  std::vector<int> counts_;          // Substeps per segment
+  std::vector<long> chunk_offsets_;  // Chunk splat counts, then prefix sums
+};
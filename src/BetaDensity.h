@@ -0,0 +1,63 @@
+#pragma once
+
+#include "BeamSplatter.h"
+#include "BetaDensityTable.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Expected beam segment lengths of the test signal, from a precomputed sweep
+// The RPM oscillator's orbit goes from clean to intermittent to noise as beta
+// grows, and how long its XY segments run decides how densely the beam has
+// to be interpolated. tests/beta_analysis.cpp sweeps beta, exponent,
+// frequency and detune once, offline and on every core, into
+// BetaDensityTable.h; lookup() interpolates it over beta and log frequency so
+// the renderer can size the substep spacing for a frame before generating it.
+struct BetaDensity {
+  float mean;  // Mean segment length, signal units per sample
+  float p99;   // 99th percentile segment length
+  float chaos; // 0 for a clean orbit, towards 1 as it turns to noise
+
+  static BetaDensity lookup(double beta, int exponent, double frequency,
+                            double sample_rate) {
+    using T = BetaDensityTable;
+    const int e = std::clamp(exponent - 1, 0, T::kExponents - 1);
+
+    const double bp = std::clamp((beta - T::kMinBeta) / T::kBetaStep, 0.0,
+                                 static_cast<double>(T::kBetas - 1));
+    const double fp = std::clamp(
+        (T::kFrequencies - 1) * std::log(frequency / T::kMinFrequency) /
+            std::log(T::kMaxFrequency / T::kMinFrequency),
+        0.0, static_cast<double>(T::kFrequencies - 1));
+    const int b0 = std::min(static_cast<int>(bp), T::kBetas - 2);
+    const int f0 = std::min(static_cast<int>(fp), T::kFrequencies - 2);
+    const float tb = static_cast<float>(bp - b0);
+    const float tf = static_cast<float>(fp - f0);
+
+    const auto &row0 = T::kCells[e][b0];
+    const auto &row1 = T::kCells[e][b0 + 1];
+    float v[3];
+    for (int k = 0; k < 3; ++k) {
+      const float lo = row0[f0][k] + tf * (row0[f0 + 1][k] - row0[f0][k]);
+      const float hi = row1[f0][k] + tf * (row1[f0 + 1][k] - row1[f0][k]);
+      v[k] = lo + tb * (hi - lo);
+    }
+
+    // Swept at one rate: a smooth orbit's steps shrink as the rate rises
+    const float rate = static_cast<float>(T::kSampleRate / sample_rate);
+    return {v[0] * rate, v[1] * rate, v[2]};
+  }
+
+  // Substep spacing in pixels for a frame of samples at unit_px pixels per
+  // signal unit: nominal where the orbit is clean, wide enough that the
+  // longest segments (the Nyquist ringing of the chaotic 4-7 zone) fit the
+  // substep clamp and the whole frame fits budget splats, and no denser than
+  // one beam width along noise
+  static float stepDist(const BetaDensity &density, float unit_px,
+                        int samples, int budget, float nominal, float beam) {
+    const float path = density.mean * unit_px * std::max(0, samples - 1);
+    return std::max({nominal,
+                     density.p99 * unit_px / BeamSplatter::kMaxSubsteps,
+                     path / std::max(1, budget), density.chaos * beam});
+  }
+};
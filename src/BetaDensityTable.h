@@ -0,0 +1,633 @@
+#pragma once
+
+// Generated by tests/beta_analysis.cpp (--sweep); do not edit.
+// TestSignalGenerator XY segment lengths at 44100 Hz per exponent, beta
+// and frequency, worst case over detune: {mean, p99, chaos}. See
+// BetaDensity.h.
+struct BetaDensityTable {
+  static constexpr double kSampleRate = 44100;
+  static constexpr int kExponents = 2;
+  static constexpr int kBetas = 61;
+  static constexpr double kMinBeta = -10;
+  static constexpr double kBetaStep = 1;
+  static constexpr int kFrequencies = 8;
+  static constexpr double kMinFrequency = 10;
+  static constexpr double kMaxFrequency = 500;
+
+  static constexpr float kCells[kExponents][kBetas][kFrequencies][3] = {
+    {
+      // beta -10
+      {{0.7041f, 2.122f, 0.9984f}, {0.7097f, 2.122f, 0.9974f},
+       {0.7089f, 2.12f, 0.9955f}, {0.7022f, 2.122f, 0.9922f},
+       {0.7027f, 2.12f, 0.9862f}, {0.7156f, 2.115f, 0.976f},
+       {0.7944f, 2.115f, 0.9617f}, {0.8806f, 2.141f, 0.9401f}},
+      // beta -9
+      {{0.6726f, 2.101f, 0.9984f}, {0.6611f, 2.097f, 0.9972f},
+       {0.6624f, 2.093f, 0.9952f}, {0.6497f, 2.1f, 0.9916f},
+       {0.6378f, 2.102f, 0.9849f}, {0.6295f, 2.089f, 0.9734f},
+       {0.6204f, 2.09f, 0.9525f}, {0.64f, 2.095f, 0.9168f}},
+      // beta -8
+      {{0.8797f, 2.126f, 0.9988f}, {0.8495f, 2.122f, 0.9979f},
+       {0.8523f, 2.125f, 0.9962f}, {0.8207f, 2.128f, 0.9933f},
+       {0.8042f, 2.131f, 0.988f}, {0.8049f, 2.132f, 0.9791f},
+       {0.8943f, 2.134f, 0.9664f}, {1.057f, 2.127f, 0.9477f}},
+      // beta -7
+      {{1.12f, 2.136f, 0.999f}, {1.073f, 2.136f, 0.9983f},
+       {1.088f, 2.136f, 0.997f}, {1.042f, 2.135f, 0.9947f},
+       {1.037f, 2.136f, 0.9907f}, {1.034f, 2.133f, 0.9838f},
+       {0.9943f, 2.12f, 0.9704f}, {0.9705f, 2.081f, 0.9458f}},
+      // beta -6
+      {{1.321f, 2.151f, 0.9992f}, {1.297f, 2.151f, 0.9986f},
+       {1.321f, 2.151f, 0.9975f}, {1.232f, 2.151f, 0.9955f},
+       {1.212f, 2.151f, 0.9921f}, {1.198f, 2.15f, 0.986f},
+       {1.172f, 2.15f, 0.9748f}, {1.18f, 2.151f, 0.9542f}},
+      // beta -5
+      {{1.286f, 2.071f, 0.9992f}, {1.295f, 2.071f, 0.9986f},
+       {1.3f, 2.071f, 0.9975f}, {1.197f, 2.071f, 0.9954f},
+       {1.186f, 2.072f, 0.9919f}, {1.175f, 2.073f, 0.9857f},
+       {1.155f, 2.076f, 0.9744f}, {1.177f, 2.08f, 0.9542f}},
+      // beta -4
+      {{0.9395f, 1.773f, 0.9988f}, {0.9617f, 1.773f, 0.9981f},
+       {0.9704f, 1.773f, 0.9967f}, {0.8896f, 1.774f, 0.9938f},
+       {0.892f, 1.775f, 0.9892f}, {0.8972f, 1.777f, 0.9813f},
+       {0.8995f, 1.78f, 0.967f}, {0.9418f, 1.786f, 0.9423f}},
+      // beta -3
+      {{0.001256f, 0.00501f, 0.6032f}, {0.002204f, 0.01614f, 0.5978f},
+       {0.003703f, 0.04599f, 0.5798f}, {0.006632f, 0.1223f, 0.5836f},
+       {0.01155f, 0.237f, 0.5803f}, {0.02008f, 0.3648f, 0.5824f},
+       {0.03521f, 0.4929f, 0.5866f}, {0.06166f, 0.6651f, 0.5996f}},
+      // beta -2
+      {{0.001254f, 0.007366f, 0.537f}, {0.002121f, 0.01805f, 0.51f},
+       {0.003779f, 0.05528f, 0.5033f}, {0.006581f, 0.1233f, 0.5f},
+       {0.01139f, 0.2059f, 0.4916f}, {0.01973f, 0.2697f, 0.4853f},
+       {0.03426f, 0.3931f, 0.4709f}, {0.05898f, 0.4947f, 0.4434f}},
+      // beta -1
+      {{0.001218f, 0.01366f, 0.3267f}, {0.002063f, 0.02167f, 0.3129f},
+       {0.003652f, 0.03462f, 0.3342f}, {0.006369f, 0.05792f, 0.3452f},
+       {0.01102f, 0.09005f, 0.3324f}, {0.01933f, 0.1346f, 0.329f},
+       {0.03363f, 0.1929f, 0.3063f}, {0.05831f, 0.2706f, 0.2706f}},
+      // beta 0
+      {{0.001188f, 0.002015f, 0.0f}, {0.00201f, 0.00358f, 0.0f},
+       {0.003494f, 0.006266f, 0.0f}, {0.006067f, 0.01096f, 0.0f},
+       {0.01059f, 0.01917f, 0.0f}, {0.01853f, 0.03352f, 0.0f},
+       {0.03247f, 0.0586f, 0.0f}, {0.05674f, 0.1024f, 0.0f}},
+      // beta 1
+      {{0.001223f, 0.01377f, 0.3216f}, {0.002103f, 0.02269f, 0.3528f},
+       {0.003621f, 0.03536f, 0.3608f}, {0.006329f, 0.05783f, 0.3446f},
+       {0.01102f, 0.09094f, 0.3328f}, {0.01923f, 0.1343f, 0.3244f},
+       {0.03354f, 0.1926f, 0.3058f}, {0.05823f, 0.2713f, 0.2707f}},
+      // beta 2
+      {{0.001338f, 0.008737f, 0.5384f}, {0.002186f, 0.02093f, 0.534f},
+       {0.003758f, 0.05616f, 0.5231f}, {0.006533f, 0.1272f, 0.4985f},
+       {0.01128f, 0.2039f, 0.4926f}, {0.01955f, 0.2693f, 0.4802f},
+       {0.03385f, 0.3913f, 0.4664f}, {0.05873f, 0.5005f, 0.448f}},
+      // beta 3
+      {{0.001243f, 0.005012f, 0.6011f}, {0.002118f, 0.01366f, 0.5872f},
+       {0.003882f, 0.05616f, 0.5973f}, {0.006623f, 0.1263f, 0.583f},
+       {0.01148f, 0.2314f, 0.5819f}, {0.01996f, 0.3735f, 0.5784f},
+       {0.0348f, 0.49f, 0.5838f}, {0.06153f, 0.6483f, 0.5963f}},
+      // beta 4
+      {{0.902f, 1.773f, 0.9988f}, {0.9161f, 1.773f, 0.998f},
+       {0.9372f, 1.773f, 0.9965f}, {0.8959f, 1.774f, 0.9938f},
+       {0.8865f, 1.775f, 0.9891f}, {0.8979f, 1.777f, 0.9813f},
+       {0.8989f, 1.78f, 0.967f}, {0.9413f, 1.785f, 0.9423f}},
+      // beta 5
+      {{1.218f, 2.071f, 0.9991f}, {1.262f, 2.071f, 0.9985f},
+       {1.264f, 2.071f, 0.9974f}, {1.203f, 2.071f, 0.9954f},
+       {1.178f, 2.072f, 0.9918f}, {1.175f, 2.073f, 0.9857f},
+       {1.156f, 2.076f, 0.9744f}, {1.178f, 2.08f, 0.9542f}},
+      // beta 6
+      {{1.233f, 2.151f, 0.9991f}, {1.297f, 2.151f, 0.9986f},
+       {1.292f, 2.151f, 0.9975f}, {1.231f, 2.151f, 0.9955f},
+       {1.205f, 2.15f, 0.992f}, {1.2f, 2.151f, 0.986f},
+       {1.173f, 2.15f, 0.9748f}, {1.173f, 2.151f, 0.9539f}},
+      // beta 7
+      {{1.051f, 2.136f, 0.999f}, {1.093f, 2.135f, 0.9983f},
+       {1.076f, 2.136f, 0.997f}, {1.041f, 2.135f, 0.9947f},
+       {1.034f, 2.136f, 0.9907f}, {1.035f, 2.133f, 0.9838f},
+       {0.9966f, 2.119f, 0.9704f}, {0.9611f, 2.098f, 0.9453f}},
+      // beta 8
+      {{0.8423f, 2.119f, 0.9987f}, {0.8775f, 2.125f, 0.9979f},
+       {0.8516f, 2.126f, 0.9962f}, {0.8208f, 2.128f, 0.9933f},
+       {0.8037f, 2.13f, 0.988f}, {0.7954f, 2.134f, 0.9788f},
+       {0.8899f, 2.137f, 0.9657f}, {1.111f, 2.139f, 0.9504f}},
+      // beta 9
+      {{0.6713f, 2.092f, 0.9984f}, {0.6885f, 2.098f, 0.9973f},
+       {0.67f, 2.097f, 0.9952f}, {0.6508f, 2.101f, 0.9916f},
+       {0.6462f, 2.093f, 0.9851f}, {0.6321f, 2.096f, 0.9735f},
+       {0.6301f, 2.094f, 0.9528f}, {0.6126f, 2.118f, 0.9141f}},
+      // beta 10
+      {{0.7341f, 2.12f, 0.9985f}, {0.7269f, 2.118f, 0.9975f},
+       {0.7251f, 2.115f, 0.9955f}, {0.7015f, 2.121f, 0.9922f},
+       {0.7062f, 2.115f, 0.9862f}, {0.7369f, 2.115f, 0.9767f},
+       {0.7646f, 2.116f, 0.9614f}, {0.8372f, 2.115f, 0.9358f}},
+      // beta 11
+      {{0.8463f, 2.144f, 0.9987f}, {0.8232f, 2.144f, 0.9978f},
+       {0.8306f, 2.144f, 0.9961f}, {0.8165f, 2.144f, 0.9932f},
+       {0.8271f, 2.144f, 0.9882f}, {0.8805f, 2.144f, 0.9808f},
+       {0.9201f, 2.144f, 0.9672f}, {0.9528f, 2.142f, 0.9459f}},
+      // beta 12
+      {{0.8395f, 2.129f, 0.9987f}, {0.8338f, 2.127f, 0.9978f},
+       {0.8471f, 2.13f, 0.9963f}, {0.9018f, 2.131f, 0.9939f},
+       {0.9287f, 2.135f, 0.9896f}, {0.9519f, 2.137f, 0.9822f},
+       {0.9794f, 2.142f, 0.9696f}, {1.003f, 2.148f, 0.9488f}},
+      // beta 13
+      {{0.8635f, 2.123f, 0.9987f}, {0.8695f, 2.125f, 0.9979f},
+       {0.9137f, 2.127f, 0.9965f}, {0.9748f, 2.134f, 0.9942f},
+       {0.9089f, 2.129f, 0.9894f}, {0.9561f, 2.129f, 0.9823f},
+       {0.9769f, 2.13f, 0.9691f}, {0.9784f, 2.134f, 0.9473f}},
+      // beta 14
+      {{1.111f, 2.121f, 0.9991f}, {1.125f, 2.121f, 0.9985f},
+       {1.131f, 2.122f, 0.9973f}, {1.118f, 2.123f, 0.9952f},
+       {1.13f, 2.126f, 0.9915f}, {1.115f, 2.128f, 0.985f},
+       {1.126f, 2.132f, 0.9739f}, {1.102f, 2.134f, 0.9534f}},
+      // beta 15
+      {{1.33f, 2.145f, 0.9992f}, {1.324f, 2.145f, 0.9987f},
+       {1.313f, 2.145f, 0.9976f}, {1.3f, 2.145f, 0.9958f},
+       {1.296f, 2.145f, 0.9925f}, {1.285f, 2.144f, 0.987f},
+       {1.256f, 2.144f, 0.9766f}, {1.244f, 2.143f, 0.9582f}},
+      // beta 16
+      {{1.219f, 2.148f, 0.9992f}, {1.222f, 2.147f, 0.9986f},
+       {1.213f, 2.148f, 0.9975f}, {1.211f, 2.148f, 0.9955f},
+       {1.199f, 2.148f, 0.992f}, {1.176f, 2.146f, 0.9856f},
+       {1.148f, 2.147f, 0.9743f}, {1.136f, 2.148f, 0.9544f}},
+      // beta 17
+      {{1.117f, 2.126f, 0.9991f}, {1.107f, 2.124f, 0.9984f},
+       {1.111f, 2.126f, 0.9972f}, {1.116f, 2.129f, 0.9952f},
+       {1.104f, 2.131f, 0.9913f}, {1.106f, 2.126f, 0.9848f},
+       {1.093f, 2.126f, 0.9731f}, {1.091f, 2.129f, 0.9528f}},
+      // beta 18
+      {{1.127f, 2.132f, 0.9991f}, {1.132f, 2.132f, 0.9985f},
+       {1.134f, 2.131f, 0.9973f}, {1.132f, 2.132f, 0.9952f},
+       {1.131f, 2.13f, 0.9915f}, {1.132f, 2.128f, 0.9852f},
+       {1.129f, 2.132f, 0.974f}, {1.12f, 2.13f, 0.954f}},
+      // beta 19
+      {{1.498f, 2.152f, 0.9993f}, {1.477f, 2.152f, 0.9988f},
+       {1.465f, 2.152f, 0.9979f}, {1.442f, 2.152f, 0.9962f},
+       {1.464f, 2.152f, 0.9934f}, {1.423f, 2.152f, 0.9882f},
+       {1.399f, 2.152f, 0.9788f}, {1.358f, 2.152f, 0.9622f}},
+      // beta 20
+      {{1.219f, 2.135f, 0.9991f}, {1.214f, 2.135f, 0.9986f},
+       {1.186f, 2.135f, 0.9974f}, {1.18f, 2.134f, 0.9954f},
+       {1.182f, 2.135f, 0.9919f}, {1.163f, 2.133f, 0.9855f},
+       {1.142f, 2.135f, 0.9741f}, {1.122f, 2.133f, 0.9539f}},
+      // beta 21
+      {{1.082f, 2.137f, 0.9991f}, {1.058f, 2.139f, 0.9984f},
+       {1.056f, 2.135f, 0.9971f}, {1.041f, 2.13f, 0.9949f},
+       {1.041f, 2.128f, 0.9907f}, {1.042f, 2.133f, 0.9838f},
+       {1.04f, 2.131f, 0.9715f}, {1.037f, 2.134f, 0.9502f}},
+      // beta 22
+      {{1.042f, 2.132f, 0.999f}, {1.037f, 2.131f, 0.9983f},
+       {1.042f, 2.129f, 0.9971f}, {1.037f, 2.13f, 0.9948f},
+       {1.035f, 2.129f, 0.9907f}, {1.028f, 2.129f, 0.9837f},
+       {1.031f, 2.129f, 0.9714f}, {1.029f, 2.13f, 0.95f}},
+      // beta 23
+      {{1.014f, 2.124f, 0.999f}, {1.023f, 2.124f, 0.9983f},
+       {1.021f, 2.124f, 0.997f}, {1.014f, 2.121f, 0.9947f},
+       {1.016f, 2.12f, 0.9905f}, {1.013f, 2.125f, 0.9834f},
+       {1.02f, 2.124f, 0.9708f}, {1.012f, 2.125f, 0.9493f}},
+      // beta 24
+      {{1.057f, 2.124f, 0.999f}, {1.06f, 2.128f, 0.9984f},
+       {1.053f, 2.126f, 0.9971f}, {1.057f, 2.124f, 0.9949f},
+       {1.058f, 2.126f, 0.9909f}, {1.052f, 2.125f, 0.984f},
+       {1.052f, 2.126f, 0.972f}, {1.053f, 2.126f, 0.9511f}},
+      // beta 25
+      {{1.043f, 2.132f, 0.999f}, {1.041f, 2.136f, 0.9983f},
+       {1.039f, 2.132f, 0.9971f}, {1.043f, 2.136f, 0.9948f},
+       {1.039f, 2.133f, 0.9908f}, {1.043f, 2.134f, 0.9839f},
+       {1.05f, 2.136f, 0.972f}, {1.049f, 2.134f, 0.9507f}},
+      // beta 26
+      {{1.08f, 2.145f, 0.9991f}, {1.07f, 2.137f, 0.9984f},
+       {1.065f, 2.135f, 0.9971f}, {1.06f, 2.136f, 0.9949f},
+       {1.062f, 2.133f, 0.9909f}, {1.058f, 2.137f, 0.9841f},
+       {1.055f, 2.133f, 0.9721f}, {1.056f, 2.134f, 0.9512f}},
+      // beta 27
+      {{1.031f, 2.132f, 0.999f}, {1.028f, 2.131f, 0.9983f},
+       {1.032f, 2.133f, 0.997f}, {1.034f, 2.13f, 0.9948f},
+       {1.031f, 2.129f, 0.9907f}, {1.032f, 2.126f, 0.9837f},
+       {1.032f, 2.131f, 0.9714f}, {1.039f, 2.127f, 0.9504f}},
+      // beta 28
+      {{1.014f, 2.134f, 0.999f}, {1.017f, 2.132f, 0.9983f},
+       {1.017f, 2.133f, 0.997f}, {1.015f, 2.132f, 0.9947f},
+       {1.01f, 2.129f, 0.9905f}, {1.019f, 2.132f, 0.9836f},
+       {1.011f, 2.133f, 0.9709f}, {1.018f, 2.134f, 0.9493f}},
+      // beta 29
+      {{1.027f, 2.129f, 0.999f}, {1.031f, 2.129f, 0.9983f},
+       {1.032f, 2.126f, 0.997f}, {1.03f, 2.128f, 0.9948f},
+       {1.031f, 2.125f, 0.9906f}, {1.032f, 2.131f, 0.9837f},
+       {1.027f, 2.131f, 0.9713f}, {1.03f, 2.128f, 0.95f}},
+      // beta 30
+      {{1.048f, 2.131f, 0.999f}, {1.046f, 2.131f, 0.9983f},
+       {1.049f, 2.129f, 0.9971f}, {1.042f, 2.134f, 0.9948f},
+       {1.046f, 2.133f, 0.9908f}, {1.043f, 2.132f, 0.9839f},
+       {1.04f, 2.129f, 0.9717f}, {1.047f, 2.136f, 0.9509f}},
+      // beta 31
+      {{1.185f, 2.143f, 0.9991f}, {1.174f, 2.143f, 0.9985f},
+       {1.173f, 2.143f, 0.9973f}, {1.152f, 2.143f, 0.9952f},
+       {1.126f, 2.143f, 0.9915f}, {1.121f, 2.143f, 0.9848f},
+       {1.088f, 2.141f, 0.973f}, {1.072f, 2.139f, 0.9521f}},
+      // beta 32
+      {{1.172f, 2.146f, 0.9991f}, {1.166f, 2.146f, 0.9985f},
+       {1.149f, 2.146f, 0.9973f}, {1.142f, 2.146f, 0.9953f},
+       {1.139f, 2.145f, 0.9915f}, {1.102f, 2.145f, 0.9847f},
+       {1.095f, 2.143f, 0.9731f}, {1.095f, 2.145f, 0.953f}},
+      // beta 33
+      {{1.079f, 2.133f, 0.9991f}, {1.076f, 2.134f, 0.9984f},
+       {1.071f, 2.135f, 0.9972f}, {1.07f, 2.135f, 0.995f},
+       {1.067f, 2.134f, 0.991f}, {1.065f, 2.135f, 0.9842f},
+       {1.067f, 2.131f, 0.9725f}, {1.059f, 2.134f, 0.9515f}},
+      // beta 34
+      {{1.056f, 2.136f, 0.999f}, {1.057f, 2.134f, 0.9984f},
+       {1.051f, 2.137f, 0.9971f}, {1.058f, 2.139f, 0.9949f},
+       {1.051f, 2.137f, 0.9909f}, {1.05f, 2.135f, 0.9841f},
+       {1.057f, 2.139f, 0.9722f}, {1.054f, 2.137f, 0.9512f}},
+      // beta 35
+      {{1.051f, 2.133f, 0.999f}, {1.057f, 2.131f, 0.9984f},
+       {1.053f, 2.131f, 0.9971f}, {1.047f, 2.131f, 0.9949f},
+       {1.055f, 2.134f, 0.9909f}, {1.051f, 2.134f, 0.984f},
+       {1.047f, 2.133f, 0.9718f}, {1.05f, 2.134f, 0.951f}},
+      // beta 36
+      {{1.06f, 2.129f, 0.999f}, {1.06f, 2.129f, 0.9984f},
+       {1.068f, 2.135f, 0.9971f}, {1.066f, 2.131f, 0.9949f},
+       {1.059f, 2.128f, 0.9909f}, {1.067f, 2.133f, 0.9842f},
+       {1.06f, 2.132f, 0.9722f}, {1.063f, 2.132f, 0.9517f}},
+      // beta 37
+      {{1.066f, 2.132f, 0.999f}, {1.071f, 2.138f, 0.9984f},
+       {1.071f, 2.138f, 0.9972f}, {1.065f, 2.134f, 0.995f},
+       {1.075f, 2.135f, 0.991f}, {1.078f, 2.135f, 0.9844f},
+       {1.072f, 2.137f, 0.9725f}, {1.072f, 2.136f, 0.9521f}},
+      // beta 38
+      {{1.068f, 2.133f, 0.999f}, {1.068f, 2.137f, 0.9984f},
+       {1.072f, 2.135f, 0.9971f}, {1.068f, 2.131f, 0.995f},
+       {1.065f, 2.135f, 0.991f}, {1.065f, 2.136f, 0.9843f},
+       {1.066f, 2.136f, 0.9723f}, {1.064f, 2.133f, 0.9516f}},
+      // beta 39
+      {{1.052f, 2.13f, 0.999f}, {1.061f, 2.132f, 0.9984f},
+       {1.055f, 2.132f, 0.9971f}, {1.063f, 2.135f, 0.995f},
+       {1.051f, 2.132f, 0.9909f}, {1.053f, 2.133f, 0.9841f},
+       {1.055f, 2.129f, 0.972f}, {1.048f, 2.132f, 0.951f}},
+      // beta 40
+      {{1.039f, 2.132f, 0.999f}, {1.039f, 2.132f, 0.9983f},
+       {1.042f, 2.134f, 0.9971f}, {1.041f, 2.138f, 0.9948f},
+       {1.038f, 2.132f, 0.9907f}, {1.037f, 2.13f, 0.9838f},
+       {1.038f, 2.132f, 0.9715f}, {1.04f, 2.128f, 0.9505f}},
+      // beta 41
+      {{1.032f, 2.133f, 0.999f}, {1.028f, 2.137f, 0.9983f},
+       {1.034f, 2.135f, 0.9971f}, {1.025f, 2.134f, 0.9947f},
+       {1.038f, 2.135f, 0.9907f}, {1.033f, 2.131f, 0.9838f},
+       {1.033f, 2.132f, 0.9716f}, {1.036f, 2.135f, 0.9499f}},
+      // beta 42
+      {{1.022f, 2.13f, 0.999f}, {1.029f, 2.129f, 0.9983f},
+       {1.027f, 2.13f, 0.997f}, {1.028f, 2.13f, 0.9948f},
+       {1.026f, 2.132f, 0.9906f}, {1.027f, 2.133f, 0.9837f},
+       {1.025f, 2.131f, 0.9712f}, {1.024f, 2.127f, 0.9498f}},
+      // beta 43
+      {{1.027f, 2.135f, 0.999f}, {1.027f, 2.13f, 0.9983f},
+       {1.027f, 2.13f, 0.997f}, {1.025f, 2.135f, 0.9948f},
+       {1.021f, 2.135f, 0.9906f}, {1.028f, 2.132f, 0.9836f},
+       {1.023f, 2.133f, 0.9713f}, {1.027f, 2.132f, 0.9499f}},
+      // beta 44
+      {{1.233f, 2.153f, 0.9991f}, {1.21f, 2.153f, 0.9986f},
+       {1.193f, 2.153f, 0.9974f}, {1.159f, 2.152f, 0.9953f},
+       {1.133f, 2.152f, 0.9915f}, {1.116f, 2.149f, 0.985f},
+       {1.095f, 2.15f, 0.9728f}, {1.07f, 2.145f, 0.952f}},
+      // beta 45
+      {{1.082f, 2.141f, 0.9991f}, {1.061f, 2.14f, 0.9984f},
+       {1.071f, 2.138f, 0.9971f}, {1.064f, 2.137f, 0.9949f},
+       {1.061f, 2.134f, 0.991f}, {1.046f, 2.134f, 0.984f},
+       {1.053f, 2.139f, 0.9719f}, {1.054f, 2.134f, 0.951f}},
+      // beta 46
+      {{1.044f, 2.135f, 0.999f}, {1.04f, 2.135f, 0.9983f},
+       {1.043f, 2.136f, 0.9971f}, {1.043f, 2.137f, 0.9949f},
+       {1.049f, 2.136f, 0.9908f}, {1.049f, 2.135f, 0.984f},
+       {1.048f, 2.136f, 0.9718f}, {1.044f, 2.135f, 0.9506f}},
+      // beta 47
+      {{1.048f, 2.135f, 0.999f}, {1.049f, 2.136f, 0.9984f},
+       {1.049f, 2.133f, 0.9971f}, {1.041f, 2.132f, 0.9948f},
+       {1.046f, 2.133f, 0.9908f}, {1.042f, 2.136f, 0.9839f},
+       {1.043f, 2.134f, 0.9717f}, {1.045f, 2.132f, 0.9508f}},
+      // beta 48
+      {{1.052f, 2.134f, 0.999f}, {1.052f, 2.13f, 0.9984f},
+       {1.048f, 2.131f, 0.9971f}, {1.04f, 2.131f, 0.9949f},
+       {1.047f, 2.132f, 0.9908f}, {1.051f, 2.132f, 0.984f},
+       {1.048f, 2.133f, 0.9719f}, {1.049f, 2.133f, 0.9509f}},
+      // beta 49
+      {{1.046f, 2.137f, 0.999f}, {1.048f, 2.136f, 0.9984f},
+       {1.05f, 2.136f, 0.9971f}, {1.05f, 2.136f, 0.9949f},
+       {1.042f, 2.136f, 0.9908f}, {1.051f, 2.136f, 0.9841f},
+       {1.048f, 2.136f, 0.9718f}, {1.053f, 2.138f, 0.9511f}},
+      // beta 50
+      {{1.042f, 2.134f, 0.999f}, {1.038f, 2.131f, 0.9983f},
+       {1.048f, 2.135f, 0.9971f}, {1.04f, 2.135f, 0.9949f},
+       {1.038f, 2.136f, 0.9907f}, {1.046f, 2.132f, 0.9838f},
+       {1.041f, 2.133f, 0.9714f}, {1.043f, 2.136f, 0.9506f}},
+    },
+    {
+      // beta -10
+      {{0.3891f, 1.361f, 0.9972f}, {0.3839f, 1.297f, 0.9951f},
+       {0.3571f, 1.176f, 0.9912f}, {0.3417f, 1.122f, 0.9839f},
+       {0.3215f, 1.092f, 0.9701f}, {0.3137f, 1.14f, 0.9456f},
+       {0.2931f, 1.133f, 0.8956f}, {0.2526f, 1.406f, 0.7898f}},
+      // beta -9
+      {{0.4784f, 1.311f, 0.9977f}, {0.4665f, 1.307f, 0.996f},
+       {0.4357f, 1.299f, 0.9927f}, {0.4193f, 1.282f, 0.9869f},
+       {0.3963f, 1.232f, 0.9758f}, {0.3766f, 1.163f, 0.9548f},
+       {0.3606f, 1.113f, 0.9144f}, {0.3079f, 1.327f, 0.8297f}},
+      // beta -8
+      {{0.4976f, 1.207f, 0.9978f}, {0.4806f, 1.206f, 0.9961f},
+       {0.4496f, 1.204f, 0.9929f}, {0.431f, 1.199f, 0.9873f},
+       {0.4141f, 1.185f, 0.9768f}, {0.395f, 1.148f, 0.9569f},
+       {0.376f, 1.089f, 0.9179f}, {0.3251f, 1.292f, 0.842f}},
+      // beta -7
+      {{0.4435f, 1.053f, 0.9976f}, {0.446f, 1.053f, 0.9956f},
+       {0.4166f, 1.053f, 0.9923f}, {0.3967f, 1.053f, 0.9861f},
+       {0.385f, 1.049f, 0.9751f}, {0.3696f, 1.037f, 0.9539f},
+       {0.354f, 1.007f, 0.9126f}, {0.3155f, 1.191f, 0.8372f}},
+      // beta -6
+      {{0.3169f, 0.8121f, 0.9996f}, {0.3347f, 0.8119f, 0.9993f},
+       {0.3096f, 0.8115f, 0.9987f}, {0.2972f, 0.8108f, 0.9972f},
+       {0.2903f, 0.8094f, 0.993f}, {0.2815f, 0.8016f, 0.9816f},
+       {0.2707f, 0.9217f, 0.9474f}, {0.2513f, 1.11f, 0.8903f}},
+      // beta -5
+      {{0.05722f, 0.2524f, 0.9961f}, {0.06387f, 0.2472f, 0.9943f},
+       {0.06422f, 0.2419f, 0.991f}, {0.0695f, 0.3151f, 0.9878f},
+       {0.07767f, 0.451f, 0.9767f}, {0.09062f, 0.5774f, 0.9647f},
+       {0.1112f, 0.806f, 0.9459f}, {0.1352f, 0.957f, 0.9158f}},
+      // beta -4
+      {{0.00156f, 0.01545f, 0.7944f}, {0.002595f, 0.04392f, 0.7808f},
+       {0.004544f, 0.0936f, 0.7846f}, {0.008064f, 0.2262f, 0.786f},
+       {0.01428f, 0.3531f, 0.7913f}, {0.02539f, 0.4753f, 0.8023f},
+       {0.04538f, 0.6522f, 0.808f}, {0.07874f, 0.7901f, 0.803f}},
+      // beta -3
+      {{0.001382f, 0.01429f, 0.6811f}, {0.002247f, 0.03988f, 0.6695f},
+       {0.003964f, 0.1011f, 0.6751f}, {0.006916f, 0.1748f, 0.6762f},
+       {0.01201f, 0.2359f, 0.6764f}, {0.02096f, 0.3474f, 0.6872f},
+       {0.03694f, 0.4611f, 0.7041f}, {0.06505f, 0.5827f, 0.7292f}},
+      // beta -2
+      {{0.001282f, 0.02195f, 0.4977f}, {0.002163f, 0.03583f, 0.5106f},
+       {0.003781f, 0.0538f, 0.5252f}, {0.006604f, 0.08481f, 0.5323f},
+       {0.01145f, 0.1273f, 0.532f}, {0.02009f, 0.1829f, 0.5381f},
+       {0.03522f, 0.2575f, 0.5594f}, {0.06163f, 0.3599f, 0.5882f}},
+      // beta -1
+      {{0.001215f, 0.003723f, 0.1891f}, {0.002063f, 0.00656f, 0.2183f},
+       {0.003584f, 0.0116f, 0.217f}, {0.006231f, 0.02052f, 0.2302f},
+       {0.01087f, 0.03616f, 0.2502f}, {0.01908f, 0.06309f, 0.2731f},
+       {0.03352f, 0.1084f, 0.3035f}, {0.05881f, 0.1825f, 0.3417f}},
+      // beta 0
+      {{0.001188f, 0.002015f, 0.0f}, {0.00201f, 0.00358f, 0.0f},
+       {0.003494f, 0.006266f, 0.0f}, {0.006067f, 0.01096f, 0.0f},
+       {0.01059f, 0.01917f, 0.0f}, {0.01853f, 0.03352f, 0.0f},
+       {0.03247f, 0.0586f, 0.0f}, {0.05674f, 0.1024f, 0.0f}},
+      // beta 1
+      {{0.001226f, 0.003624f, 0.1952f}, {0.00205f, 0.006256f, 0.2039f},
+       {0.003571f, 0.01072f, 0.191f}, {0.006202f, 0.01812f, 0.1882f},
+       {0.01078f, 0.03001f, 0.1478f}, {0.01881f, 0.04854f, 0.01889f},
+       {0.03273f, 0.07652f, 0.009832f}, {0.0566f, 0.1179f, 0.0f}},
+      // beta 2
+      {{0.001294f, 0.01854f, 0.5176f}, {0.002144f, 0.02537f, 0.5129f},
+       {0.003747f, 0.03895f, 0.5101f}, {0.006492f, 0.05536f, 0.4846f},
+       {0.01119f, 0.07436f, 0.4345f}, {0.01938f, 0.098f, 0.4103f},
+       {0.03335f, 0.1285f, 0.3635f}, {0.05694f, 0.1688f, 0.2544f}},
+      // beta 3
+      {{0.001279f, 0.01864f, 0.5976f}, {0.002177f, 0.03956f, 0.5773f},
+       {0.003784f, 0.06524f, 0.5705f}, {0.006545f, 0.0867f, 0.5532f},
+       {0.01125f, 0.1235f, 0.5168f}, {0.01946f, 0.1554f, 0.4773f},
+       {0.03346f, 0.1865f, 0.4415f}, {0.05706f, 0.2234f, 0.3799f}},
+      // beta 4
+      {{0.001277f, 0.01563f, 0.6283f}, {0.002166f, 0.03406f, 0.609f},
+       {0.003783f, 0.07382f, 0.6072f}, {0.006556f, 0.1136f, 0.5957f},
+       {0.01129f, 0.151f, 0.5699f}, {0.01959f, 0.1998f, 0.5387f},
+       {0.03381f, 0.2369f, 0.5056f}, {0.05786f, 0.2726f, 0.4669f}},
+      // beta 5
+      {{0.001308f, 0.01445f, 0.6693f}, {0.002228f, 0.03999f, 0.6539f},
+       {0.003909f, 0.0827f, 0.6533f}, {0.006816f, 0.1264f, 0.6453f},
+       {0.01185f, 0.1657f, 0.6266f}, {0.02086f, 0.2313f, 0.5989f},
+       {0.03738f, 0.2775f, 0.5488f}, {0.08374f, 0.314f, 0.3396f}},
+      // beta 6
+      {{0.4423f, 0.8133f, 0.9975f}, {0.4653f, 0.8141f, 0.996f},
+       {0.4452f, 0.8153f, 0.9929f}, {0.4509f, 0.8176f, 0.9878f},
+       {0.4558f, 0.8215f, 0.9788f}, {0.4664f, 0.828f, 0.9635f},
+       {0.4812f, 0.8402f, 0.9365f}, {0.4692f, 0.86f, 0.8903f}},
+      // beta 7
+      {{0.71f, 1.054f, 0.9985f}, {0.721f, 1.054f, 0.9974f},
+       {0.6967f, 1.055f, 0.9955f}, {0.6931f, 1.057f, 0.9921f},
+       {0.6855f, 1.061f, 0.986f}, {0.6868f, 1.067f, 0.9753f},
+       {0.6894f, 1.077f, 0.956f}, {0.6501f, 1.098f, 0.9208f}},
+      // beta 8
+      {{0.7505f, 1.388f, 0.9985f}, {0.7523f, 1.39f, 0.9975f},
+       {0.7359f, 1.371f, 0.9957f}, {0.7428f, 1.338f, 0.9926f},
+       {0.7475f, 1.257f, 0.9871f}, {0.7481f, 1.221f, 0.9774f},
+       {0.7241f, 1.339f, 0.9582f}, {0.6555f, 1.459f, 0.9216f}},
+      // beta 9
+      {{0.7792f, 1.68f, 0.9986f}, {0.775f, 1.679f, 0.9976f},
+       {0.7516f, 1.679f, 0.9958f}, {0.7417f, 1.677f, 0.9926f},
+       {0.7178f, 1.678f, 0.9866f}, {0.6989f, 1.686f, 0.976f},
+       {0.675f, 1.681f, 0.9561f}, {0.6266f, 1.705f, 0.9165f}},
+      // beta 10
+      {{0.7705f, 1.804f, 0.9986f}, {0.7653f, 1.808f, 0.9976f},
+       {0.7517f, 1.808f, 0.9958f}, {0.7633f, 1.821f, 0.9928f},
+       {0.7728f, 1.823f, 0.9876f}, {0.797f, 1.846f, 0.9787f},
+       {0.8121f, 1.859f, 0.9632f}, {0.847f, 1.877f, 0.9385f}},
+      // beta 11
+      {{0.6905f, 1.858f, 0.9984f}, {0.6975f, 1.849f, 0.9973f},
+       {0.6841f, 1.85f, 0.9953f}, {0.6859f, 1.859f, 0.9919f},
+       {0.6981f, 1.875f, 0.9862f}, {0.7251f, 1.891f, 0.9766f},
+       {0.7537f, 1.922f, 0.9601f}, {0.7884f, 1.978f, 0.9349f}},
+      // beta 12
+      {{0.6813f, 1.85f, 0.9984f}, {0.7005f, 1.853f, 0.9973f},
+       {0.6955f, 1.872f, 0.9954f}, {0.6958f, 1.87f, 0.9921f},
+       {0.7063f, 1.894f, 0.9864f}, {0.7212f, 1.919f, 0.9766f},
+       {0.7396f, 1.95f, 0.9595f}, {0.7653f, 1.992f, 0.9321f}},
+      // beta 13
+      {{0.7353f, 2.094f, 0.9985f}, {0.7364f, 2.082f, 0.9975f},
+       {0.7391f, 2.084f, 0.9957f}, {0.7444f, 2.079f, 0.9926f},
+       {0.7509f, 2.083f, 0.9872f}, {0.7646f, 2.078f, 0.9778f},
+       {0.789f, 2.066f, 0.962f}, {0.7831f, 2.058f, 0.9335f}},
+      // beta 14
+      {{0.815f, 2.132f, 0.9987f}, {0.8139f, 2.13f, 0.9978f},
+       {0.8129f, 2.129f, 0.9961f}, {0.8156f, 2.128f, 0.9932f},
+       {0.8174f, 2.124f, 0.9882f}, {0.8232f, 2.12f, 0.9796f},
+       {0.8428f, 2.111f, 0.9649f}, {0.8614f, 2.103f, 0.9396f}},
+      // beta 15
+      {{0.8974f, 2.15f, 0.9988f}, {0.8894f, 2.149f, 0.998f},
+       {0.885f, 2.15f, 0.9965f}, {0.8872f, 2.15f, 0.9938f},
+       {0.896f, 2.15f, 0.9892f}, {0.9075f, 2.149f, 0.9815f},
+       {0.9304f, 2.149f, 0.9681f}, {0.9537f, 2.145f, 0.9461f}},
+      // beta 16
+      {{0.9219f, 2.139f, 0.9988f}, {0.9081f, 2.14f, 0.998f},
+       {0.9108f, 2.138f, 0.9966f}, {0.9071f, 2.136f, 0.9939f},
+       {0.9136f, 2.134f, 0.9895f}, {0.9335f, 2.139f, 0.9818f},
+       {0.9316f, 2.14f, 0.9681f}, {0.9404f, 2.14f, 0.9443f}},
+      // beta 17
+      {{0.8985f, 2.139f, 0.9988f}, {0.9f, 2.141f, 0.998f},
+       {0.9015f, 2.137f, 0.9965f}, {0.9073f, 2.14f, 0.994f},
+       {0.9202f, 2.139f, 0.9895f}, {0.9175f, 2.141f, 0.9817f},
+       {0.9413f, 2.14f, 0.9685f}, {0.9514f, 2.134f, 0.9454f}},
+      // beta 18
+      {{0.9221f, 2.136f, 0.9989f}, {0.9405f, 2.139f, 0.9981f},
+       {0.9417f, 2.139f, 0.9967f}, {0.9433f, 2.137f, 0.9943f},
+       {0.9593f, 2.138f, 0.9899f}, {0.9719f, 2.138f, 0.9826f},
+       {0.9919f, 2.138f, 0.9702f}, {1.005f, 2.139f, 0.9489f}},
+      // beta 19
+      {{0.955f, 2.136f, 0.9989f}, {0.9643f, 2.134f, 0.9982f},
+       {0.9616f, 2.135f, 0.9968f}, {0.9724f, 2.134f, 0.9944f},
+       {0.9773f, 2.134f, 0.9902f}, {0.9977f, 2.134f, 0.9832f},
+       {1.007f, 2.136f, 0.9705f}, {1.017f, 2.137f, 0.9495f}},
+      // beta 20
+      {{1.069f, 2.136f, 0.999f}, {1.063f, 2.135f, 0.9984f},
+       {1.06f, 2.134f, 0.9971f}, {1.058f, 2.133f, 0.9949f},
+       {1.065f, 2.132f, 0.991f}, {1.059f, 2.132f, 0.9841f},
+       {1.062f, 2.13f, 0.9721f}, {1.056f, 2.13f, 0.9514f}},
+      // beta 21
+      {{1.14f, 2.149f, 0.9991f}, {1.133f, 2.149f, 0.9984f},
+       {1.132f, 2.149f, 0.9973f}, {1.15f, 2.148f, 0.9953f},
+       {1.14f, 2.145f, 0.9916f}, {1.137f, 2.143f, 0.9853f},
+       {1.129f, 2.14f, 0.9739f}, {1.12f, 2.136f, 0.9541f}},
+      // beta 22
+      {{1.165f, 2.151f, 0.9991f}, {1.153f, 2.15f, 0.9985f},
+       {1.149f, 2.15f, 0.9973f}, {1.145f, 2.148f, 0.9953f},
+       {1.144f, 2.146f, 0.9916f}, {1.135f, 2.145f, 0.9852f},
+       {1.131f, 2.141f, 0.9739f}, {1.117f, 2.14f, 0.954f}},
+      // beta 23
+      {{1.111f, 2.147f, 0.9991f}, {1.107f, 2.145f, 0.9984f},
+       {1.105f, 2.143f, 0.9972f}, {1.109f, 2.143f, 0.9951f},
+       {1.107f, 2.143f, 0.9913f}, {1.109f, 2.142f, 0.9849f},
+       {1.106f, 2.14f, 0.9734f}, {1.107f, 2.14f, 0.9534f}},
+      // beta 24
+      {{1.09f, 2.144f, 0.9991f}, {1.08f, 2.142f, 0.9984f},
+       {1.083f, 2.142f, 0.9972f}, {1.086f, 2.141f, 0.995f},
+       {1.085f, 2.141f, 0.9911f}, {1.088f, 2.142f, 0.9845f},
+       {1.082f, 2.141f, 0.9727f}, {1.091f, 2.141f, 0.9528f}},
+      // beta 25
+      {{1.098f, 2.142f, 0.9991f}, {1.094f, 2.138f, 0.9984f},
+       {1.1f, 2.143f, 0.9972f}, {1.095f, 2.141f, 0.9951f},
+       {1.096f, 2.139f, 0.9912f}, {1.093f, 2.139f, 0.9846f},
+       {1.097f, 2.138f, 0.9732f}, {1.096f, 2.138f, 0.953f}},
+      // beta 26
+      {{1.118f, 2.138f, 0.9991f}, {1.103f, 2.133f, 0.9984f},
+       {1.11f, 2.134f, 0.9972f}, {1.097f, 2.132f, 0.9951f},
+       {1.103f, 2.132f, 0.9913f}, {1.098f, 2.134f, 0.9847f},
+       {1.094f, 2.138f, 0.9731f}, {1.099f, 2.132f, 0.953f}},
+      // beta 27
+      {{1.082f, 2.132f, 0.9991f}, {1.084f, 2.134f, 0.9984f},
+       {1.079f, 2.132f, 0.9972f}, {1.084f, 2.13f, 0.995f},
+       {1.084f, 2.132f, 0.9911f}, {1.088f, 2.135f, 0.9846f},
+       {1.085f, 2.133f, 0.9728f}, {1.087f, 2.135f, 0.9526f}},
+      // beta 28
+      {{1.061f, 2.135f, 0.999f}, {1.068f, 2.135f, 0.9984f},
+       {1.073f, 2.135f, 0.9971f}, {1.063f, 2.131f, 0.9949f},
+       {1.066f, 2.133f, 0.9909f}, {1.066f, 2.134f, 0.9843f},
+       {1.066f, 2.134f, 0.9722f}, {1.065f, 2.136f, 0.9517f}},
+      // beta 29
+      {{1.038f, 2.135f, 0.999f}, {1.042f, 2.136f, 0.9983f},
+       {1.044f, 2.136f, 0.9971f}, {1.046f, 2.135f, 0.9948f},
+       {1.042f, 2.136f, 0.9908f}, {1.046f, 2.138f, 0.984f},
+       {1.05f, 2.136f, 0.972f}, {1.056f, 2.136f, 0.9509f}},
+      // beta 30
+      {{1.038f, 2.132f, 0.999f}, {1.03f, 2.133f, 0.9983f},
+       {1.041f, 2.134f, 0.9971f}, {1.033f, 2.135f, 0.9948f},
+       {1.033f, 2.135f, 0.9907f}, {1.034f, 2.136f, 0.9837f},
+       {1.041f, 2.133f, 0.9716f}, {1.038f, 2.133f, 0.9504f}},
+      // beta 31
+      {{1.04f, 2.136f, 0.999f}, {1.043f, 2.136f, 0.9983f},
+       {1.043f, 2.135f, 0.9971f}, {1.047f, 2.135f, 0.9949f},
+       {1.043f, 2.136f, 0.9908f}, {1.041f, 2.135f, 0.9839f},
+       {1.039f, 2.134f, 0.9717f}, {1.04f, 2.137f, 0.9502f}},
+      // beta 32
+      {{1.036f, 2.139f, 0.999f}, {1.036f, 2.139f, 0.9983f},
+       {1.038f, 2.14f, 0.9971f}, {1.043f, 2.139f, 0.9948f},
+       {1.044f, 2.14f, 0.9908f}, {1.046f, 2.139f, 0.9838f},
+       {1.046f, 2.138f, 0.9717f}, {1.044f, 2.136f, 0.9508f}},
+      // beta 33
+      {{1.036f, 2.133f, 0.999f}, {1.037f, 2.134f, 0.9983f},
+       {1.041f, 2.134f, 0.9971f}, {1.037f, 2.135f, 0.9948f},
+       {1.041f, 2.136f, 0.9907f}, {1.031f, 2.131f, 0.9838f},
+       {1.038f, 2.135f, 0.9717f}, {1.039f, 2.134f, 0.9506f}},
+      // beta 34
+      {{1.029f, 2.134f, 0.999f}, {1.031f, 2.133f, 0.9983f},
+       {1.028f, 2.136f, 0.997f}, {1.033f, 2.134f, 0.9948f},
+       {1.033f, 2.134f, 0.9907f}, {1.034f, 2.134f, 0.9838f},
+       {1.036f, 2.137f, 0.9715f}, {1.036f, 2.135f, 0.9501f}},
+      // beta 35
+      {{1.029f, 2.131f, 0.999f}, {1.032f, 2.131f, 0.9983f},
+       {1.032f, 2.133f, 0.997f}, {1.028f, 2.132f, 0.9948f},
+       {1.029f, 2.133f, 0.9907f}, {1.03f, 2.137f, 0.9837f},
+       {1.027f, 2.133f, 0.9714f}, {1.033f, 2.134f, 0.9502f}},
+      // beta 36
+      {{1.038f, 2.138f, 0.999f}, {1.038f, 2.137f, 0.9983f},
+       {1.035f, 2.137f, 0.997f}, {1.036f, 2.137f, 0.9948f},
+       {1.023f, 2.135f, 0.9906f}, {1.033f, 2.136f, 0.9837f},
+       {1.034f, 2.136f, 0.9716f}, {1.043f, 2.138f, 0.9504f}},
+      // beta 37
+      {{1.044f, 2.14f, 0.999f}, {1.042f, 2.139f, 0.9983f},
+       {1.037f, 2.14f, 0.997f}, {1.038f, 2.139f, 0.9948f},
+       {1.04f, 2.139f, 0.9907f}, {1.042f, 2.14f, 0.9838f},
+       {1.039f, 2.141f, 0.9716f}, {1.039f, 2.139f, 0.9504f}},
+      // beta 38
+      {{1.026f, 2.139f, 0.999f}, {1.036f, 2.14f, 0.9983f},
+       {1.03f, 2.139f, 0.997f}, {1.029f, 2.139f, 0.9948f},
+       {1.034f, 2.14f, 0.9907f}, {1.031f, 2.141f, 0.9837f},
+       {1.032f, 2.139f, 0.9714f}, {1.032f, 2.137f, 0.9501f}},
+      // beta 39
+      {{1.026f, 2.135f, 0.999f}, {1.034f, 2.136f, 0.9983f},
+       {1.029f, 2.135f, 0.997f}, {1.03f, 2.132f, 0.9948f},
+       {1.031f, 2.135f, 0.9907f}, {1.028f, 2.133f, 0.9837f},
+       {1.03f, 2.134f, 0.9714f}, {1.034f, 2.135f, 0.9503f}},
+      // beta 40
+      {{1.019f, 2.135f, 0.999f}, {1.027f, 2.132f, 0.9983f},
+       {1.03f, 2.136f, 0.997f}, {1.024f, 2.135f, 0.9948f},
+       {1.03f, 2.136f, 0.9907f}, {1.028f, 2.136f, 0.9837f},
+       {1.027f, 2.136f, 0.9713f}, {1.032f, 2.135f, 0.9502f}},
+      // beta 41
+      {{1.04f, 2.132f, 0.999f}, {1.034f, 2.134f, 0.9983f},
+       {1.036f, 2.136f, 0.997f}, {1.04f, 2.137f, 0.9948f},
+       {1.039f, 2.133f, 0.9907f}, {1.038f, 2.138f, 0.9839f},
+       {1.04f, 2.137f, 0.9716f}, {1.029f, 2.134f, 0.9501f}},
+      // beta 42
+      {{1.027f, 2.139f, 0.999f}, {1.033f, 2.137f, 0.9983f},
+       {1.031f, 2.136f, 0.997f}, {1.037f, 2.139f, 0.9948f},
+       {1.038f, 2.139f, 0.9907f}, {1.033f, 2.139f, 0.9838f},
+       {1.038f, 2.139f, 0.9716f}, {1.034f, 2.137f, 0.9502f}},
+      // beta 43
+      {{1.043f, 2.135f, 0.999f}, {1.044f, 2.135f, 0.9983f},
+       {1.04f, 2.138f, 0.9971f}, {1.042f, 2.139f, 0.9948f},
+       {1.038f, 2.137f, 0.9907f}, {1.039f, 2.139f, 0.9838f},
+       {1.04f, 2.141f, 0.9717f}, {1.039f, 2.139f, 0.9506f}},
+      // beta 44
+      {{1.046f, 2.137f, 0.999f}, {1.04f, 2.136f, 0.9983f},
+       {1.049f, 2.139f, 0.9971f}, {1.048f, 2.137f, 0.9949f},
+       {1.045f, 2.137f, 0.9908f}, {1.046f, 2.137f, 0.9839f},
+       {1.044f, 2.139f, 0.9716f}, {1.05f, 2.137f, 0.9508f}},
+      // beta 45
+      {{1.056f, 2.136f, 0.999f}, {1.052f, 2.136f, 0.9984f},
+       {1.051f, 2.136f, 0.9971f}, {1.052f, 2.136f, 0.9949f},
+       {1.06f, 2.138f, 0.9909f}, {1.056f, 2.137f, 0.984f},
+       {1.049f, 2.135f, 0.972f}, {1.051f, 2.137f, 0.9511f}},
+      // beta 46
+      {{1.047f, 2.135f, 0.999f}, {1.047f, 2.136f, 0.9984f},
+       {1.045f, 2.135f, 0.9971f}, {1.054f, 2.136f, 0.9949f},
+       {1.056f, 2.135f, 0.9909f}, {1.05f, 2.134f, 0.984f},
+       {1.053f, 2.135f, 0.972f}, {1.053f, 2.136f, 0.9512f}},
+      // beta 47
+      {{1.054f, 2.135f, 0.999f}, {1.05f, 2.134f, 0.9984f},
+       {1.058f, 2.134f, 0.9971f}, {1.051f, 2.132f, 0.9949f},
+       {1.052f, 2.133f, 0.9909f}, {1.048f, 2.135f, 0.984f},
+       {1.049f, 2.134f, 0.9719f}, {1.055f, 2.135f, 0.9509f}},
+      // beta 48
+      {{1.06f, 2.139f, 0.999f}, {1.052f, 2.137f, 0.9984f},
+       {1.054f, 2.138f, 0.9971f}, {1.056f, 2.139f, 0.9949f},
+       {1.058f, 2.138f, 0.9909f}, {1.059f, 2.139f, 0.9841f},
+       {1.056f, 2.14f, 0.9722f}, {1.052f, 2.136f, 0.9509f}},
+      // beta 49
+      {{1.064f, 2.14f, 0.999f}, {1.055f, 2.141f, 0.9984f},
+       {1.059f, 2.139f, 0.9971f}, {1.067f, 2.139f, 0.995f},
+       {1.066f, 2.139f, 0.991f}, {1.06f, 2.14f, 0.9842f},
+       {1.062f, 2.139f, 0.9723f}, {1.063f, 2.139f, 0.9515f}},
+      // beta 50
+      {{1.062f, 2.136f, 0.999f}, {1.064f, 2.139f, 0.9984f},
+       {1.064f, 2.141f, 0.9971f}, {1.06f, 2.138f, 0.9949f},
+       {1.059f, 2.139f, 0.9909f}, {1.059f, 2.14f, 0.9842f},
+       {1.065f, 2.137f, 0.9723f}, {1.061f, 2.138f, 0.9516f}},
+    },
+  };
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "dsp/dfl_FastMath.h"
+#include "dsp/dfl_HalfBand.h"
+
 #include <algorithm>
 #include <cmath>
 
@@ -46,6 +49,19 @@ public:
     updateCoeffs();
   }
 
+  // Glide the cutoff to fc over the next num_samples process() calls.
+  // The tan() runs once here; process() only interpolates g linearly.
+  void rampCutoff(double fc, int num_samples) {
+    cutoff_ = std::clamp(fc, 20.0, sample_rate_ * 0.49);
+    const double target = std::tan(kPi * cutoff_ / sample_rate_);
+    if (num_samples <= 0) {
+      updateCoeffs();
+      return;
+    }
+    g_step_ = (target - g_) / num_samples;
+    ramp_remaining_ = num_samples;
+  }
+
   struct Outputs {
     double lp, bp, hp;
   };
@@ -58,6 +74,12 @@ public:
 
     in *= kBaseInputGain * pre_gain_;
 
+    if (ramp_remaining_ > 0) {
+      g_ += g_step_;
+      a1_ = 1.0 / (1.0 + g_ * (g_ + k_));
+      --ramp_remaining_;
+    }
+
     // Soft-clip the input combined with feedback - this is where energy enters
     // At high resonance the filter self-oscillates; saturation limits amplitude
     double v0 = softClip(in - k_ * z1_ - z2_);
@@ -67,15 +89,30 @@ public:
 
     // Update state (trapezoidal integration)
     // Soft-clip before feedback to prevent runaway at extreme freq/resonance
-    z1_ = 2.0 * softClip(bp) - z1_;
-    z2_ = 2.0 * softClip(lp) - z2_;
+    z1_ = 2.0 * stateClip(bp) - z1_;
+    z2_ = 2.0 * stateClip(lp) - z2_;
 
     return { lp * kOutputGain, bp * kOutputGain, hp * kOutputGain };
   }
 
+  // process() over in[0..n) into lp/bp/hp. The feedback recurrence is serial
+  // and a hand-unrolled copy measured no faster, so this is the same kernel
+  // in a loop; the oversampler and FilterMorpher's mixing work on the blocks.
+  void processBlock(const float* in, float* lp, float* bp, float* hp, int n) {
+    for (int i = 0; i < n; ++i) {
+      const Outputs o = process(in[i]);
+      lp[i] = static_cast<float>(o.lp);
+      bp[i] = static_cast<float>(o.bp);
+      hp[i] = static_cast<float>(o.hp);
+    }
+  }
+
   void setPreGain(double g) { pre_gain_ = g; }
   double preGain() const { return pre_gain_; }
 
+  // Fraction of the state saturation applied per sample (1 / oversampling)
+  void setStateClipAmount(double amount) { state_clip_ = amount; }
+
   void reset() { z1_ = z2_ = 0.0; }
 
   // Get specific output from last process() call
@@ -93,13 +130,20 @@ public:
 
 private:
   // Soft saturation using tanh - allows self-oscillation to stabilize
-  static double softClip(double x) { return std::tanh(x); }
+  // Pade approximant: within 1e-6 of std::tanh for |x| < 3, ~0.02% at worst
+  static double softClip(double x) { return dfl::fastTanh(x); }
+
+  // State saturation is applied once per sample, so its compression per second
+  // grows with the sample rate. Scaling the nonlinear part keeps the response
+  // the same when the filter runs oversampled.
+  double stateClip(double x) const { return x + state_clip_ * (softClip(x) - x); }
 
   void updateCoeffs() {
     g_ = std::tan(kPi * cutoff_ / sample_rate_);
     // Allow true self-oscillation: k=0 when resonance=1
     k_ = 2.0 * (1.0 - resonance_);
     a1_ = 1.0 / (1.0 + g_ * (g_ + k_));
+    ramp_remaining_ = 0;
   }
 
   double sample_rate_ = 44100.0;
@@ -108,6 +152,83 @@ private:
   double pre_gain_ = 1.0;
   double g_ = 0.0, k_ = 1.0, a1_ = 1.0;
   double z1_ = 0.0, z2_ = 0.0;
+  double state_clip_ = 1.0;
+  double g_step_ = 0.0; // Per-sample g increment while ramping
+  int ramp_remaining_ = 0;
+};
+
+// SimpleSVF running at 1x/2x/4x the stream rate
+// The tanh saturation in the feedback loop generates harmonics above Nyquist at
+// high regen and cutoff. Running the filter oversampled and decimating its
+// LP/BP/HP outputs keeps them from folding back as fuzz on the scope.
+class OversampledSVF {
+public:
+  using Outputs = SimpleSVF::Outputs;
+
+  static constexpr int kMaxBlock = 64; // Internal chunk at the base rate
+
+  void setSampleRate(double sr) {
+    base_rate_ = sr;
+    svf_.setSampleRate(base_rate_ * factor_);
+  }
+
+  // Factor is 1, 2 or 4. Resamplers restart; filter state is kept.
+  void setOversampling(int factor) {
+    up_.setFactor(factor);
+    lp_down_.setFactor(factor);
+    bp_down_.setFactor(factor);
+    hp_down_.setFactor(factor);
+    factor_ = up_.factor();
+    svf_.setSampleRate(base_rate_ * factor_);
+    svf_.setStateClipAmount(1.0 / factor_);
+  }
+  int oversampling() const { return factor_; }
+
+  void setCutoff(double fc) { svf_.setCutoff(fc); }
+  void setResonance(double r) { svf_.setResonance(r); }
+  void rampCutoff(double fc, int num_samples) { svf_.rampCutoff(fc, num_samples * factor_); }
+  void setPreGain(double g) { svf_.setPreGain(g); }
+  double preGain() const { return svf_.preGain(); }
+
+  void reset() {
+    svf_.reset();
+    setOversampling(factor_);
+  }
+
+  Outputs process(double in) {
+    float x = static_cast<float>(in), lp, bp, hp;
+    processBlock(&x, &lp, &bp, &hp, 1);
+    return { lp, bp, hp };
+  }
+
+  void processBlock(const float* in, float* lp, float* bp, float* hp, int n) {
+    if (factor_ == 1) {
+      svf_.processBlock(in, lp, bp, hp, n);
+      return;
+    }
+
+    for (int done = 0; done < n;) {
+      const int count = std::min(kMaxBlock, n - done);
+      const int count_os = count * factor_;
+      up_.up(in + done, up_buf_, count);
+      svf_.processBlock(up_buf_, lp_buf_, bp_buf_, hp_buf_, count_os);
+      lp_down_.down(lp_buf_, lp + done, count);
+      bp_down_.down(bp_buf_, bp + done, count);
+      hp_down_.down(hp_buf_, hp + done, count);
+      done += count;
+    }
+  }
+
+private:
+  static constexpr int kBufSize = kMaxBlock * dfl::Oversampler::kMaxFactor;
+
+  SimpleSVF svf_;
+  double base_rate_ = 44100.0;
+  int factor_ = 1;
+
+  dfl::Oversampler up_, lp_down_, bp_down_, hp_down_;
+  float up_buf_[kBufSize];
+  float lp_buf_[kBufSize], bp_buf_[kBufSize], hp_buf_[kBufSize];
 };
 
 // Stereo filter router: mono input -> X/Y outputs via selectable filter modes
@@ -296,6 +417,28 @@ public:
     return { x_out, y_out };
   }
 
+  // Block kernels: same mix as apply()/applyXY() over n samples.
+  // Each weight set folds into one coefficient per filter output, so the
+  // inner loops are plain multiply-adds that compilers vectorize for
+  // SSE/AVX, NEON and WASM SIMD alike.
+  void applyBlock(const float* __restrict lp, const float* __restrict bp,
+                  const float* __restrict hp, float* __restrict out, int n) const {
+    const Mix m = mixFor(radius_, w_lp_, w_bp_, w_hp_, w_br_);
+    for (int i = 0; i < n; ++i)
+      out[i] = m.lp * lp[i] + m.bp * bp[i] + m.hp * hp[i];
+  }
+
+  void applyXYBlock(const float* __restrict lp, const float* __restrict bp,
+                    const float* __restrict hp, float* __restrict x,
+                    float* __restrict y, int n) const {
+    const Mix mx = mixFor(radius_, w_lp_, w_bp_, w_hp_, w_br_);
+    const Mix my = mixFor(radius_y_, w_lp_y_, w_bp_y_, w_hp_y_, w_br_y_);
+    for (int i = 0; i < n; ++i) {
+      x[i] = mx.lp * lp[i] + mx.bp * bp[i] + mx.hp * hp[i];
+      y[i] = my.lp * lp[i] + my.bp * bp[i] + my.hp * hp[i];
+    }
+  }
+
   // Weight accessors for visualization
   float wLP() const { return w_lp_; }
   float wBP() const { return w_bp_; }
@@ -319,6 +462,16 @@ private:
     return (1.0f - r) * allpass + r * filtered;
   }
 
+  // applyWithWeights() expanded per filter output:
+  // (1 - r) * (lp + hp - bp) + r * (w_lp * lp + w_bp * bp + w_hp * hp + w_br * (lp + hp))
+  struct Mix {
+    float lp, bp, hp;
+  };
+  static Mix mixFor(float r, float w_lp, float w_bp, float w_hp, float w_br) {
+    const float ap = 1.0f - r;
+    return { ap + r * (w_lp + w_br), r * w_bp - ap, ap + r * (w_hp + w_br) };
+  }
+
   static void computeWeights(float angle, float& w_lp, float& w_bp, float& w_hp, float& w_br) {
     // Map angle to 4 modes evenly spaced:
     // 0 (right) = HP, pi/2 (up) = BP, pi (left) = LP, 3pi/2 (down) = BR
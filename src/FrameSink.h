@@ -0,0 +1,117 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Hands rendered frames from the render thread to encoder threads
+// submit() copies the pixels and returns as soon as a slot is free, so the GPU
+// keeps rendering while frames are compressed or written. A bounded queue
+// keeps memory flat when encoding is the bottleneck.
+//
+// With ordered = true frames reach the writer in submission order on a single
+// thread (a pipe or one raw file); otherwise num_threads writers run in
+// parallel (one image file per frame).
+class FrameSink {
+public:
+  using Writer =
+      std::function<bool(int index, const uint8_t *rgba, int width, int height)>;
+
+  FrameSink(Writer writer, int num_threads, bool ordered)
+      : writer_(std::move(writer)) {
+    if (ordered || num_threads < 1)
+      num_threads = 1;
+    max_queued_ = 2 * num_threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads_.emplace_back([this] { run(); });
+  }
+
+  ~FrameSink() { finish(); }
+
+  FrameSink(const FrameSink &) = delete;
+  FrameSink &operator=(const FrameSink &) = delete;
+
+  // Queue a frame; blocks while the queue is full. Returns false once a
+  // write has failed.
+  bool submit(int index, const uint8_t *rgba, int width, int height) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_.wait(lock, [&] { return queue_.size() < max_queued_ || failed_; });
+    if (failed_)
+      return false;
+
+    Job job;
+    if (!free_.empty()) {
+      job.pixels = std::move(free_.back());
+      free_.pop_back();
+    }
+    job.index = index;
+    job.width = width;
+    job.height = height;
+    job.pixels.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+    queue_.push_back(std::move(job));
+    ready_.notify_one();
+    return true;
+  }
+
+  // Wait for all queued frames. Returns false if any write failed.
+  bool finish() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      done_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread &t : threads_)
+      t.join();
+    threads_.clear();
+    return !failed_;
+  }
+
+private:
+  struct Job {
+    int index = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+  };
+
+  void run() {
+    for (;;) {
+      Job job;
+      bool skip = false;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [&] { return !queue_.empty() || done_; });
+        if (queue_.empty())
+          return;
+        job = std::move(queue_.front());
+        queue_.pop_front();
+        skip = failed_;
+      }
+      space_.notify_one();
+
+      bool ok = skip || writer_(job.index, job.pixels.data(), job.width,
+                                job.height);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!ok)
+        failed_ = true;
+      free_.push_back(std::move(job.pixels)); // Reuse the allocation
+      space_.notify_all();
+    }
+  }
+
+  Writer writer_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::condition_variable space_;
+  std::deque<Job> queue_;
+  std::vector<std::vector<uint8_t>> free_;
+  size_t max_queued_ = 2;
+  bool done_ = false;
+  bool failed_ = false;
+};
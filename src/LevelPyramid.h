@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Min/max/power decimation pyramid (a digital scope's peak-detect acquisition)
+// Level 0 summarizes base_frames samples per bucket and each level above
+// merges kFanout buckets of the one below, so any window can be reduced to a
+// fixed number of columns by reading at most a few buckets per column,
+// whatever its length. Built incrementally by push() at O(1) amortized cost.
+//
+// Buckets are addressed by absolute sample position and stored in rings sized
+// to the capacity, so the pyramid can shadow a ring buffer (retaining what it
+// retains) or hold a whole file when capacity covers it.
+class LevelPyramid {
+public:
+  static constexpr int kFanout = 4;
+
+  struct Bucket {
+    float lo = 0.0f;
+    float hi = 0.0f;
+    float power = 0.0f; // Mean square
+
+    void merge(const Bucket &b) {
+      lo = std::min(lo, b.lo);
+      hi = std::max(hi, b.hi);
+      power += b.power;
+    }
+  };
+
+  // capacity and base_frames must be powers of two
+  void setCapacity(size_t capacity, size_t base_frames) {
+    base_ = base_frames;
+    levels_.clear();
+    for (size_t span = base_; span <= capacity; span *= kFanout) {
+      Level level;
+      level.span = span;
+      level.buckets.assign(capacity / span, Bucket());
+      levels_.push_back(std::move(level));
+    }
+    reset();
+  }
+
+  void reset() {
+    for (Level &level : levels_) {
+      level.acc = Bucket();
+      level.count = 0;
+    }
+    pos_ = 0;
+  }
+
+  size_t baseFrames() const { return base_; }
+  bool empty() const { return levels_.empty(); }
+
+  void push(float x) {
+    Level &base = levels_[0];
+    if (base.count == 0) {
+      base.acc.lo = base.acc.hi = x;
+      base.acc.power = 0.0f;
+    }
+    base.acc.lo = std::min(base.acc.lo, x);
+    base.acc.hi = std::max(base.acc.hi, x);
+    base.acc.power += x * x;
+    ++pos_;
+    if (++base.count == base_) {
+      base.acc.power /= static_cast<float>(base_);
+      finish(0);
+    }
+  }
+
+  // Bucket span in samples for showing len samples in columns, or 0 if len is
+  // short enough to draw sample by sample
+  size_t spanFor(size_t len, int columns) const {
+    size_t per_column = len / static_cast<size_t>(columns);
+    if (levels_.empty() || per_column < base_)
+      return 0;
+    return levels_[levelFor(per_column)].span;
+  }
+
+  // Reduce [start, start + len) to columns buckets. Only buckets complete by
+  // sample position completed are used; callers check retention.
+  void query(size_t start, size_t len, int columns, size_t completed,
+             Bucket *out) const {
+    const Level &level = levels_[levelFor(len / columns)];
+    const size_t mask = level.buckets.size() - 1;
+    const size_t last = completed / level.span; // One past the newest bucket
+
+    for (int c = 0; c < columns; ++c) {
+      size_t a = (start + len * c / columns) / level.span;
+      size_t b = (start + len * (c + 1) / columns + level.span - 1) /
+                 level.span;
+      b = std::min(b, last);
+      if (a >= b) {
+        out[c] = c > 0 ? out[c - 1] : Bucket();
+        continue;
+      }
+
+      Bucket col = level.buckets[a & mask];
+      for (size_t i = a + 1; i < b; ++i)
+        col.merge(level.buckets[i & mask]);
+      col.power /= static_cast<float>(b - a);
+      out[c] = col;
+    }
+  }
+
+private:
+  struct Level {
+    size_t span = 0;
+    std::vector<Bucket> buckets; // Ring, indexed by position / span
+    Bucket acc;
+    size_t count = 0;
+  };
+
+  size_t levelFor(size_t per_column) const {
+    size_t l = 0;
+    while (l + 1 < levels_.size() && levels_[l + 1].span <= per_column)
+      ++l;
+    return l;
+  }
+
+  // Store the bucket accumulated at level l and carry it upwards
+  void finish(size_t l) {
+    Level &level = levels_[l];
+    const size_t index = (pos_ / level.span - 1) & (level.buckets.size() - 1);
+    level.buckets[index] = level.acc;
+    level.count = 0;
+
+    if (l + 1 >= levels_.size())
+      return;
+    Level &up = levels_[l + 1];
+    if (up.count == 0)
+      up.acc = level.acc;
+    else
+      up.acc.merge(level.acc);
+    if (++up.count == static_cast<size_t>(kFanout)) {
+      up.acc.power /= static_cast<float>(kFanout);
+      finish(l + 1);
+    }
+  }
+
+  size_t base_ = 16;
+  size_t pos_ = 0;
+  std::vector<Level> levels_;
+};
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+// Range, default and smoothing of one automatable parameter
+struct ParamSpec {
+  float min, max, def;
+  float ramp_ms; // Glide time to a new value; 0 applies it at once
+  bool log;      // Glide in octaves (frequencies) rather than linearly
+};
+
+struct ParamEvent {
+  int id;
+  float value;
+};
+
+// Bounded single-producer single-consumer ring
+// push never blocks and fails when full; pop fails when empty. Capacity is a
+// power of two so indices wrap with a mask.
+template <typename T, int Capacity>
+class SpscQueue {
+public:
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity: power of two");
+
+  bool push(const T &item) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == Capacity)
+      return false;
+    items_[tail & (Capacity - 1)] = item;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+      return false;
+    item = items_[head & (Capacity - 1)];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items_[Capacity];
+  alignas(64) std::atomic<uint32_t> head_{0}; // Consumer
+  alignas(64) std::atomic<uint32_t> tail_{0}; // Producer
+};
+
+// Linear glide to a target over a whole number of steps
+class SmoothedValue {
+public:
+  void reset(float v) {
+    current_ = target_ = v;
+    inc_ = 0.0f;
+    steps_ = 0;
+  }
+
+  void setTarget(float v, int steps) {
+    target_ = v;
+    if (steps <= 0) {
+      reset(v);
+    } else {
+      inc_ = (target_ - current_) / steps;
+      steps_ = steps;
+    }
+  }
+
+  float next() {
+    if (steps_ > 0 && --steps_ == 0)
+      current_ = target_; // Land exactly, whatever the rounding on the way
+    else if (steps_ > 0)
+      current_ += inc_;
+    return current_;
+  }
+
+  float current() const { return current_; }
+  bool gliding() const { return steps_ > 0; }
+
+private:
+  float current_ = 0.0f;
+  float target_ = 0.0f;
+  float inc_ = 0.0f;
+  int steps_ = 0;
+};
+
+// A processor's parameters, addressed by integer ID
+// The control thread (UI knobs, setParam, the WASM export, later OSC/MIDI)
+// calls set(), which clamps and queues an event; the audio thread calls
+// update() once per control block, which applies every queued event and
+// advances each parameter one step along its ramp. The audio thread then reads
+// plain floats, so there is one atomic load per block rather than one per
+// parameter per sample, and knob steps arrive as glides instead of zipper
+// noise. If the queue is full the newest value is kept and sent later, so
+// bursts coalesce rather than block.
+template <int N>
+class ParamBank {
+public:
+  static constexpr int kQueueSize = 256;
+  static_assert(N <= 32, "pending_ is a 32-bit mask");
+
+  explicit ParamBank(const ParamSpec (&specs)[N]) : specs_(specs) {
+    for (int i = 0; i < N; ++i)
+      reset(i, specs_[i].def);
+    setBlockRate(44100.0 / 32.0); // Until the processor knows its rate
+  }
+
+  const ParamSpec &spec(int id) const { return specs_[id]; }
+
+  // Control thread ---------------------------------------------------------
+
+  void set(int id, float value) {
+    const ParamSpec &s = specs_[id];
+    control_[id] = std::clamp(value, s.min, s.max);
+    pending_ |= 1u << id;
+    flush();
+  }
+
+  // The last value set (not where the audio thread's glide has got to)
+  float get(int id) const { return control_[id]; }
+
+  // Queues values a full queue turned away; call now and then (each UI frame)
+  void flush() {
+    for (int id = 0; id < N && pending_; ++id) {
+      const uint32_t bit = 1u << id;
+      if (!(pending_ & bit))
+        continue;
+      if (!queue_.push({id, control_[id]}))
+        return;
+      pending_ &= ~bit;
+    }
+  }
+
+  // Sets both sides at once: only while the audio thread is stopped
+  void reset(int id, float value) {
+    const ParamSpec &s = specs_[id];
+    control_[id] = std::clamp(value, s.min, s.max);
+    smoothed_[id].reset(toDomain(id, control_[id]));
+    value_[id] = target_[id] = control_[id];
+  }
+
+  // Only while the audio thread is stopped
+  void setBlockRate(double blocks_per_second) {
+    for (int i = 0; i < N; ++i)
+      ramp_blocks_[i] = static_cast<int>(
+          std::lround(specs_[i].ramp_ms * 0.001 * blocks_per_second));
+  }
+
+  // Audio thread -----------------------------------------------------------
+
+  void update() {
+    ParamEvent e;
+    while (queue_.pop(e)) {
+      smoothed_[e.id].setTarget(toDomain(e.id, e.value), ramp_blocks_[e.id]);
+      target_[e.id] = e.value;
+      if (!smoothed_[e.id].gliding())
+        value_[e.id] = e.value;
+    }
+    for (int i = 0; i < N; ++i) {
+      if (!smoothed_[i].gliding())
+        continue;
+      const float v = smoothed_[i].next();
+      // The last step lands on the value exactly, log2/exp2 round trip aside
+      value_[i] = smoothed_[i].gliding() ? fromDomain(i, v) : target_[i];
+    }
+  }
+
+  float value(int id) const { return value_[id]; }
+
+private:
+  // Log parameters glide in log2 space; their minimum must be above zero
+  float toDomain(int id, float v) const {
+    return specs_[id].log ? std::log2(v) : v;
+  }
+  float fromDomain(int id, float v) const {
+    return specs_[id].log ? std::exp2(v) : v;
+  }
+
+  const ParamSpec (&specs_)[N];
+  SpscQueue<ParamEvent, kQueueSize> queue_;
+  float control_[N];           // Control thread
+  uint32_t pending_ = 0;       // Control thread: set but not yet queued
+  SmoothedValue smoothed_[N];  // Audio thread
+  float value_[N];             // Audio thread: current values
+  float target_[N];            // Audio thread: where each glide ends
+  int ramp_blocks_[N];
+};
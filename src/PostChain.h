@@ -0,0 +1,58 @@
+#pragma once
+
+#include "embedded/faveworm_shaders.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <visage/app.h>
+
+// Screen effects fused into a single full-screen pass (fs_post)
+// CRT, glitch, warp, sepia and gray scale would each be a full read and write
+// of the frame at output resolution if chained as separate post effects; fill
+// rate, not shading, is what integrated GPUs run out of at 4K. fs_post applies
+// all of them in one pass, branching on uniforms so stages at zero cost
+// nothing, and effect() is null when every stage is off so the frame skips
+// post-processing entirely.
+class PostChain {
+public:
+  enum Stage { kCrt, kGlitch, kWarp, kSepia, kGrayScale, kNumStages };
+
+  static constexpr float kOff = 0.001f; // At or below this a stage is skipped
+
+  void set(Stage stage, float intensity) {
+    intensity_[stage] = std::clamp(intensity, 0.0f, 1.0f);
+    if (shader_)
+      upload();
+  }
+  float get(Stage stage) const { return intensity_[stage]; }
+
+  bool active() const {
+    return std::any_of(std::begin(intensity_), std::end(intensity_),
+                       [](float i) { return i > kOff; });
+  }
+
+  // The fused pass, or null when there is nothing to apply
+  visage::PostEffect *effect() {
+    if (!active())
+      return nullptr;
+    if (!shader_) {
+      shader_ = std::make_unique<visage::ShaderPostEffect>(
+          resources::shaders::vs_custom, resources::shaders::fs_post);
+      upload();
+    }
+    return shader_.get();
+  }
+
+private:
+  void upload() {
+    shader_->setUniformValue("u_crt_params", intensity_[kCrt], 0.0f, 0.0f,
+                             0.0f);
+    shader_->setUniformValue("u_post_params", intensity_[kGlitch],
+                             intensity_[kWarp], intensity_[kSepia],
+                             intensity_[kGrayScale]);
+  }
+
+  float intensity_[kNumStages] = {};
+  std::unique_ptr<visage::ShaderPostEffect> shader_;
+};
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+// Log-scale histogram of one measurement, written by a single thread
+// Bins are a quarter octave wide from min_value up, so percentiles come out
+// within ~19% from a fixed 96 bins whatever the spread. Recording is a few
+// relaxed atomic ops and never blocks, so the audio callback can use it; the
+// UI thread reads it at any time (a snapshot may be one record behind).
+class Histogram {
+public:
+  static constexpr int kBinsPerOctave = 4;
+  static constexpr int kNumBins = 96;
+
+  explicit Histogram(double min_value = 1.0) : min_(min_value) {}
+
+  void record(double value) {
+    if (reset_.exchange(false, std::memory_order_acquire))
+      clear();
+    int bin = 0;
+    if (value > min_)
+      bin = std::min(kNumBins - 1,
+                     static_cast<int>(std::log2(value / min_) * kBinsPerOctave));
+    bins_[bin].fetch_add(1, std::memory_order_relaxed);
+    count_.store(count_.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+    sum_.store(sum_.load(std::memory_order_relaxed) + value,
+               std::memory_order_relaxed);
+    if (value > max_.load(std::memory_order_relaxed))
+      max_.store(value, std::memory_order_relaxed);
+    last_.store(value, std::memory_order_relaxed);
+  }
+
+  // Cleared by the writer on its next record
+  void reset() { reset_.store(true, std::memory_order_release); }
+
+  uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+  double last() const { return last_.load(std::memory_order_relaxed); }
+  double max() const { return max_.load(std::memory_order_relaxed); }
+  double mean() const {
+    uint64_t n = count();
+    return n ? sum_.load(std::memory_order_relaxed) / n : 0.0;
+  }
+
+  uint64_t binCount(int bin) const {
+    return bins_[bin].load(std::memory_order_relaxed);
+  }
+  double binUpper(int bin) const {
+    return min_ * std::exp2(static_cast<double>(bin + 1) / kBinsPerOctave);
+  }
+
+  // Upper edge of the bin holding the p-th fraction of records
+  double percentile(double p) const {
+    uint64_t total = 0;
+    for (int i = 0; i < kNumBins; ++i)
+      total += binCount(i);
+    if (total == 0)
+      return 0.0;
+    const double target = p * static_cast<double>(total);
+    uint64_t seen = 0;
+    for (int i = 0; i < kNumBins; ++i) {
+      seen += binCount(i);
+      if (seen >= target)
+        return std::min(binUpper(i), max());
+    }
+    return max();
+  }
+
+private:
+  void clear() {
+    for (auto &bin : bins_)
+      bin.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0.0, std::memory_order_relaxed);
+    max_.store(0.0, std::memory_order_relaxed);
+  }
+
+  double min_;
+  std::atomic<uint64_t> bins_[kNumBins] = {};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<double> sum_{0.0};
+  std::atomic<double> max_{0.0};
+  std::atomic<double> last_{0.0};
+  std::atomic<bool> reset_{false};
+};
+
+// Frame and audio-callback instrumentation
+// The audio thread records callback cost against the buffer period (the
+// deadline) and counts the xruns the driver reports; the UI thread records the
+// frame interval, where its CPU time goes, and how much of the splat budget a
+// frame uses. Any thread may read, and writeCsv/writeJson dump everything.
+//
+// GPU work (bloom, CRT) is not timed directly: it shows up as the part of the
+// frame interval not spent in frame CPU time.
+class Profiler {
+public:
+  enum Metric {
+    kAudioCallback, // us per device callback
+    kAudioLoad,     // Callback time as % of the buffer period
+    kFrameInterval, // ms between scope draws
+    kFrameCpu,      // us in Oscilloscope::draw
+    kSplatGen,      // us generating splats per frame
+    kSplatDraw,     // us submitting splats per frame
+    kSplats,        // Splats drawn per frame
+    kQuality,       // QualityGovernor level per frame
+    kNumMetrics
+  };
+
+  enum Xrun {
+    kInputUnderflow,
+    kInputOverflow,
+    kOutputUnderflow,
+    kOutputOverflow,
+    kNumXruns
+  };
+
+  static const char *name(Metric m) {
+    static const char *names[kNumMetrics] = {
+        "audio_callback", "audio_load", "frame_interval", "frame_cpu",
+        "splat_gen",      "splat_draw", "splats",    "quality"};
+    return names[m];
+  }
+
+  static const char *unit(Metric m) {
+    static const char *units[kNumMetrics] = {"us", "%",  "ms",     "us",
+                                             "us", "us", "splats", "%"};
+    return units[m];
+  }
+
+  static const char *name(Xrun x) {
+    static const char *names[kNumXruns] = {"input_underflow", "input_overflow",
+                                           "output_underflow",
+                                           "output_overflow"};
+    return names[x];
+  }
+
+  static double nowUs() {
+    using namespace std::chrono;
+    return duration<double, std::micro>(
+               steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Audio thread --------------------------------------------------------
+
+  void recordCallback(double us, double period_us) {
+    metric(kAudioCallback).record(us);
+    if (period_us > 0.0)
+      metric(kAudioLoad).record(100.0 * us / period_us);
+    period_us_.store(period_us, std::memory_order_relaxed);
+  }
+
+  void countXrun(Xrun x) { xruns_[x].fetch_add(1, std::memory_order_relaxed); }
+
+  // UI thread -----------------------------------------------------------
+
+  void setSplatBudget(int budget) { splat_budget_ = budget; }
+
+  // Any thread ----------------------------------------------------------
+
+  Histogram &metric(Metric m) { return metrics_[m]; }
+  const Histogram &metric(Metric m) const { return metrics_[m]; }
+  uint64_t xruns(Xrun x) const {
+    return xruns_[x].load(std::memory_order_relaxed);
+  }
+  uint64_t totalXruns() const {
+    uint64_t n = 0;
+    for (int x = 0; x < kNumXruns; ++x)
+      n += xruns(static_cast<Xrun>(x));
+    return n;
+  }
+  double bufferPeriodUs() const {
+    return period_us_.load(std::memory_order_relaxed);
+  }
+  int splatBudget() const { return splat_budget_; }
+
+  void reset() {
+    for (Histogram &h : metrics_)
+      h.reset();
+    for (auto &x : xruns_)
+      x.store(0, std::memory_order_relaxed);
+  }
+
+  // One summary row per metric, then the histograms as metric,bin_upper,count
+  bool writeCsv(const char *path) const {
+    FILE *f = std::fopen(path, "w");
+    if (!f)
+      return false;
+    std::fprintf(f, "metric,unit,count,mean,p50,p90,p99,max\n");
+    for (int i = 0; i < kNumMetrics; ++i) {
+      const Histogram &h = metrics_[i];
+      std::fprintf(f, "%s,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                   name(static_cast<Metric>(i)), unit(static_cast<Metric>(i)),
+                   static_cast<unsigned long long>(h.count()), h.mean(),
+                   h.percentile(0.5), h.percentile(0.9), h.percentile(0.99),
+                   h.max());
+    }
+    for (int x = 0; x < kNumXruns; ++x)
+      std::fprintf(f, "%s,count,%llu,,,,,\n", name(static_cast<Xrun>(x)),
+                   static_cast<unsigned long long>(xruns(static_cast<Xrun>(x))));
+    std::fprintf(f, "buffer_period,us,,%.3f,,,,\n", bufferPeriodUs());
+    std::fprintf(f, "splat_budget,splats,,%d,,,,\n", splat_budget_);
+
+    std::fprintf(f, "\nmetric,bin_upper,count\n");
+    for (int i = 0; i < kNumMetrics; ++i) {
+      const Histogram &h = metrics_[i];
+      for (int b = 0; b < Histogram::kNumBins; ++b) {
+        if (h.binCount(b))
+          std::fprintf(f, "%s,%.3f,%llu\n", name(static_cast<Metric>(i)),
+                       h.binUpper(b),
+                       static_cast<unsigned long long>(h.binCount(b)));
+      }
+    }
+    return std::fclose(f) == 0;
+  }
+
+  bool writeJson(const char *path) const {
+    FILE *f = std::fopen(path, "w");
+    if (!f)
+      return false;
+    std::fprintf(f, "{\n  \"buffer_period_us\": %.3f,\n", bufferPeriodUs());
+    std::fprintf(f, "  \"splat_budget\": %d,\n  \"xruns\": {", splat_budget_);
+    for (int x = 0; x < kNumXruns; ++x)
+      std::fprintf(f, "%s\"%s\": %llu", x ? ", " : "",
+                   name(static_cast<Xrun>(x)),
+                   static_cast<unsigned long long>(xruns(static_cast<Xrun>(x))));
+    std::fprintf(f, "},\n  \"metrics\": {\n");
+    for (int i = 0; i < kNumMetrics; ++i) {
+      const Histogram &h = metrics_[i];
+      std::fprintf(f,
+                   "    \"%s\": {\"unit\": \"%s\", \"count\": %llu, "
+                   "\"mean\": %.3f, \"p50\": %.3f, \"p90\": %.3f, "
+                   "\"p99\": %.3f, \"max\": %.3f, \"bins\": [",
+                   name(static_cast<Metric>(i)), unit(static_cast<Metric>(i)),
+                   static_cast<unsigned long long>(h.count()), h.mean(),
+                   h.percentile(0.5), h.percentile(0.9), h.percentile(0.99),
+                   h.max());
+      bool first = true;
+      for (int b = 0; b < Histogram::kNumBins; ++b) {
+        if (!h.binCount(b))
+          continue;
+        std::fprintf(f, "%s[%.3f, %llu]", first ? "" : ", ", h.binUpper(b),
+                     static_cast<unsigned long long>(h.binCount(b)));
+        first = false;
+      }
+      std::fprintf(f, "]}%s\n", i + 1 < kNumMetrics ? "," : "");
+    }
+    std::fprintf(f, "  }\n}\n");
+    return std::fclose(f) == 0;
+  }
+
+private:
+  Histogram metrics_[kNumMetrics] = {
+      Histogram(1.0),  Histogram(0.1), Histogram(0.1), Histogram(1.0),
+      Histogram(1.0),  Histogram(1.0), Histogram(1.0), Histogram(1.0)};
+  std::atomic<uint64_t> xruns_[kNumXruns] = {};
+  std::atomic<double> period_us_{0.0};
+  int splat_budget_ = 0;
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// Render budgets for one platform at full quality
+struct QualityProfile {
+  double target_ms;        // Frame budget the governor holds (0 = ungoverned)
+  float step_dist;         // Nominal substep spacing in pixels
+  int oversample_rate;     // Beam energy normalization
+  int max_splats;          // Beam splats per frame
+  int max_phosphor_splats; // Persistence trail splats, redrawn every frame
+  int max_splat_workers;   // Splat threads besides the UI thread
+  int bloom_levels;        // Bloom downsample levels
+  float min_quality;       // Floor the governor never goes below
+};
+
+// Desktop: threads for splat generation. The phosphor trail is re-submitted
+// every frame, so its budget stays a fraction of the beam's on both
+inline constexpr QualityProfile kDesktopQuality = {
+    1000.0 / 60.0, 1.5f, 16, 150000, 32000, 7, 5, 0.15f};
+
+// Web: one thread shared with the audio callback, a slower GPU path, and a
+// coarser beam to match
+inline constexpr QualityProfile kWebQuality = {
+    1000.0 / 60.0, 1.6f, 8, 40000, 8000, 0, 4, 0.15f};
+
+// Adaptive quality: holds a frame-time budget by scaling render cost
+// update() is fed every frame with the frame's CPU time, the interval since
+// the previous frame (which also carries GPU and post-effect time once they
+// are the bottleneck) and the audio callback load. Their worst ratio to its
+// budget is smoothed into a pressure; above 1 quality drops in proportion,
+// well below 1 it climbs back slowly, so it settles without oscillating.
+//
+// Quality scales continuous budgets (splats per frame, phosphor splats, and
+// the history frames a step while frozen rebuilds), so the beam widens its
+// spacing instead of losing segments. The discrete steps (fewer bloom levels,
+// CRT bypass) switch at thresholds with hysteresis and only near the bottom
+// of the range; a profile's floor must sit below them to reach them.
+class QualityGovernor {
+public:
+  static constexpr double kCpuShare = 0.5;  // Of the budget, for frame CPU
+  static constexpr double kAudioShare = 0.6; // Callback load treated as full
+  static constexpr double kIntervalCpuGate = 0.7; // Of the CPU share
+  static constexpr int kHistoryFrames = 4;
+  static constexpr float kBloomReduceBelow = 0.4f;
+  static constexpr float kBloomRestoreAt = 0.5f;
+  static constexpr float kCrtBypassBelow = 0.2f;
+  static constexpr float kCrtRestoreAt = 0.3f;
+
+  explicit QualityGovernor(const QualityProfile &profile)
+      : profile_(profile), target_ms_(profile.target_ms) {}
+
+  const QualityProfile &profile() const { return profile_; }
+
+  // 0 disables governing: quality stays at 1 (e.g. offline rendering)
+  void setTargetMs(double ms) {
+    target_ms_ = std::max(0.0, ms);
+    if (target_ms_ == 0.0)
+      reset();
+  }
+  double targetMs() const { return target_ms_; }
+
+  void reset() {
+    quality_ = 1.0f;
+    pressure_ = 0.0;
+    bloom_reduced_ = false;
+    crt_bypassed_ = false;
+  }
+
+  // Returns true when a discrete setting (bloomLevels, crtBypassed) changed
+  bool update(double cpu_ms, double interval_ms, double audio_load) {
+    if (target_ms_ <= 0.0)
+      return false;
+
+    double p = cpu_ms / (kCpuShare * target_ms_);
+    // Intervals within a vsync of the budget are the display, not overload,
+    // and so are long ones while the CPU has room: a slower display, a
+    // throttled tab or a budget above the refresh rate. Only a frame that is
+    // also busy blames its interval on the render.
+    if (interval_ms > 1.15 * target_ms_ && p >= kIntervalCpuGate)
+      p = std::max(p, interval_ms / target_ms_);
+    p = std::max(p, audio_load / kAudioShare);
+    p = std::min(p, 3.0); // A stall (window drag, sleep) is not a trend
+    pressure_ += 0.2 * (p - pressure_);
+
+    float q = quality_;
+    if (pressure_ > 1.05)
+      q -= static_cast<float>(0.1 * (pressure_ - 1.0)) * q;
+    else if (pressure_ < 0.8)
+      q += 0.004f; // Full recovery from the floor takes a few seconds
+    quality_ = std::clamp(q, profile_.min_quality, 1.0f);
+
+    const bool bloom = bloom_reduced_;
+    const bool crt = crt_bypassed_;
+    bloom_reduced_ =
+        quality_ < (bloom_reduced_ ? kBloomRestoreAt : kBloomReduceBelow);
+    crt_bypassed_ =
+        quality_ < (crt_bypassed_ ? kCrtRestoreAt : kCrtBypassBelow);
+    return bloom != bloom_reduced_ || crt != crt_bypassed_;
+  }
+
+  float quality() const { return quality_; }
+  double pressure() const { return pressure_; }
+
+  int splatBudget() const { return scaled(profile_.max_splats); }
+  int phosphorBudget() const { return scaled(profile_.max_phosphor_splats); }
+  // Stepped trail frames rebuildPhosphor() draws (not the live phosphor,
+  // which phosphorBudget() bounds)
+  int historyFrames() const {
+    return 2 + static_cast<int>(std::lround((kHistoryFrames - 2) * quality_));
+  }
+  int bloomLevels() const {
+    return bloom_reduced_ ? std::max(1, profile_.bloom_levels - 2)
+                          : profile_.bloom_levels;
+  }
+  bool crtBypassed() const { return crt_bypassed_; }
+
+private:
+  int scaled(int budget) const {
+    return std::max(1, static_cast<int>(budget * quality_));
+  }
+
+  QualityProfile profile_;
+  double target_ms_;
+  float quality_ = 1.0f;
+  double pressure_ = 0.0;
+  bool bloom_reduced_ = false;
+  bool crt_bypassed_ = false;
+};
+
+static_assert(kDesktopQuality.min_quality < QualityGovernor::kCrtBypassBelow &&
+                  kWebQuality.min_quality < QualityGovernor::kCrtBypassBelow,
+              "A profile's floor must reach every discrete step");
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "FilterMorpher.h"
+#include "ScopeChannel.h"
+#include "WaveformLocker.h"
+
+#include <algorithm>
+#include <cstddef>
+
+// The audio callback's per-block chain once the input is read: mono mix,
+// oversampled SVF, morpher, scope channel write with the level trigger, and
+// the gain-ramped interleaved output. AudioPlayer runs it from its callback
+// and faveworm_bench times the same code.
+//
+// The filter, morpher and channel belong to the caller, which also sets the
+// SVF's cutoff ramp for the block. The chain holds only the trigger and output
+// gain state, and runs on the channel's producer thread.
+class ScopeChain {
+public:
+  static constexpr int kMaxFrames = 32;       // Frames per block, at most
+  static constexpr int kSweepSamples = 1024;  // Trigger hold-off
+  static constexpr int kEvalSamples =
+      WaveformLocker::kWindow; // Evaluation window for waveform locking
+
+  struct Block {
+    const float *in_l = nullptr; // Main pair: filtered, triggered and heard
+    const float *in_r = nullptr;
+    const float *const *trace_xy = nullptr; // X, Y per extra trace (raw)
+    int extra_traces = 0;
+    int num_frames = 0;
+    bool filter = true;       // Run the SVF and morpher
+    bool write_scope = true;  // False while paused: the scope holds still
+    float threshold = 0.0f;   // Level trigger
+    bool rising = true;
+    float target_gain = 1.0f; // Output gain, ramped towards by ramp_inc
+    float ramp_inc = 1.0f;
+  };
+
+  ScopeChain(OversampledSVF &svf, FilterMorpher &morpher, ScopeChannel &channel)
+      : svf_(svf), morpher_(morpher), channel_(channel) {}
+
+  // out (interleaved stereo, num_frames) may be null for input-only streams
+  void process(const Block &block, float *out) {
+    const int n = block.num_frames;
+    float scope_l[kMaxFrames], scope_r[kMaxFrames];
+    float speaker_l[kMaxFrames], speaker_r[kMaxFrames];
+
+    // For scope visualization: X = raw, Y = filtered (unless split mode).
+    // Speaker output defaults to raw if the filter is disabled.
+    std::copy(block.in_l, block.in_l + n, scope_l);
+    std::copy(block.in_r, block.in_r + n, scope_r);
+    std::copy(block.in_l, block.in_l + n, speaker_l);
+    std::copy(block.in_r, block.in_r + n, speaker_r);
+
+    if (block.filter) {
+      // Process GLOBAL filter once per sample (preserving state)
+      float mono[kMaxFrames], lp[kMaxFrames], bp[kMaxFrames], hp[kMaxFrames];
+      for (int i = 0; i < n; ++i)
+        mono[i] = (block.in_l[i] + block.in_r[i]) * 0.5f;
+      svf_.processBlock(mono, lp, bp, hp, n);
+
+      // Speaker is always filtered. Without a split, applyXY returns
+      // identical L/R based on the main position.
+      morpher_.applyXYBlock(lp, bp, hp, speaker_l, speaker_r, n);
+
+      if (morpher_.hasSplit()) {
+        // Split mode: both X and Y get offset-based filtering
+        std::copy(speaker_l, speaker_l + n, scope_l);
+        std::copy(speaker_r, speaker_r + n, scope_r);
+      } else {
+        // No split: X = raw, Y = filtered with morpher
+        std::copy(speaker_l, speaker_l + n, scope_r);
+      }
+    }
+
+    if (block.write_scope)
+      writeScope(block, scope_l, scope_r);
+
+    for (int i = 0; i < n; ++i) {
+      if (gain_ < block.target_gain)
+        gain_ = std::min(block.target_gain, gain_ + block.ramp_inc);
+      else if (gain_ > block.target_gain)
+        gain_ = std::max(block.target_gain, gain_ - block.ramp_inc);
+
+      if (out) {
+        out[i * 2] = speaker_l[i] * gain_;
+        out[i * 2 + 1] = speaker_r[i] * gain_;
+      }
+    }
+  }
+
+  // Newest trigger whose evaluation window is complete, or 0 for none
+  size_t triggerPos() const { return trigger_pos_; }
+
+  // Forget triggers (the channel was cleared)
+  void resetTrigger() {
+    prev_trigger_l_ = 0.0f;
+    trigger_holdoff_ = 0;
+    pending_trigger_pos_ = trigger_pos_ = 0;
+  }
+
+  float gain() const { return gain_; }
+
+private:
+  void writeScope(const Block &block, const float *scope_l,
+                  const float *scope_r) {
+    for (int i = 0; i < block.num_frames; ++i) {
+      // Write scope samples to ring buffer (X=raw, Y=filtered or split)
+      for (int t = 0; t < block.extra_traces; ++t)
+        channel_.writeTrace(t, block.trace_xy[2 * t][i],
+                            block.trace_xy[2 * t + 1][i]);
+      channel_.write(scope_l[i], scope_r[i]);
+
+      // Level trigger in the audio thread. Waveform locking runs on the
+      // lock worker; this stays O(1) per sample.
+      const float thresh = block.threshold;
+      bool crossed =
+          block.rising ? (prev_trigger_l_ <= thresh && scope_l[i] > thresh)
+                       : (prev_trigger_l_ >= thresh && scope_l[i] < thresh);
+
+      bool find_trigger = (trigger_holdoff_ >= kSweepSamples);
+
+      if (crossed && find_trigger) {
+        pending_trigger_pos_ = channel_.head() - 1;
+        trigger_holdoff_ = 0;
+      }
+
+      // Publish once the whole evaluation window has been written
+      if (pending_trigger_pos_ != 0 &&
+          channel_.head() - pending_trigger_pos_ >= kEvalSamples) {
+        trigger_pos_ = pending_trigger_pos_;
+        pending_trigger_pos_ = 0;
+      }
+
+      prev_trigger_l_ = scope_l[i];
+      trigger_holdoff_++;
+    }
+    channel_.commit();
+  }
+
+  OversampledSVF &svf_;
+  FilterMorpher &morpher_;
+  ScopeChannel &channel_;
+
+  // Positions are absolute ring write positions; 0 means none
+  float prev_trigger_l_ = 0.0f;
+  int trigger_holdoff_ = 0;
+  size_t pending_trigger_pos_ = 0;
+  size_t trigger_pos_ = 0; // Published in the channel's stamps
+  float gain_ = 0.0f;
+};
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "LevelPyramid.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+// Lock-free single-producer / single-consumer channel carrying the scope
+// signal from the audio thread to the renderer
+// The producer writes samples into an interleaved stereo ring and publishes
+// them a block at a time, together with a stamp (stream position, clock time,
+// latest trigger). A stereo frame is one 8-byte pair, and a bulk read is at
+// most two contiguous spans. The left channel also feeds a min/max level
+// pyramid, so long windows can be read at a fixed number of columns.
+// The consumer never blocks the producer: window reads are validated after the
+// copy and report failure if the producer lapped them, and stamps are read
+// through a sequence counter so their fields are always mutually consistent.
+//
+// Extra traces (further X/Y pairs from multichannel sources) are stored beside
+// the main pair, one ring per trace, and share its positions: writeTrace()
+// fills the frame the next write() completes, and readTrace() validates exactly
+// like read(). Frames written without a writeTrace() keep old trace samples.
+//
+// Only one thread may produce at a time, and a hand-over between producers
+// must synchronize: AudioPlayer passes the channel from the audio callback
+// to the UI thread (step) and back through an atomic owner once the
+// callback has frozen on pause.
+class ScopeChannel {
+public:
+  // Most samples the producer may write before publishing them; reads closer
+  // than this to being overwritten are treated as torn
+  static constexpr size_t kMaxUnpublished = 1024;
+  static constexpr size_t kDefaultCapacity = 16384;
+  static constexpr size_t kLevelBaseFrames = 16;
+  static constexpr int kMaxExtraTraces = 3;
+
+  explicit ScopeChannel(size_t capacity = kDefaultCapacity) {
+    setCapacity(capacity);
+  }
+
+  // Resize to at least frames (rounded up to a power of two) and clear all
+  // positions. Only while neither side is using the channel.
+  void setCapacity(size_t frames) {
+    size_t size = capacityFor(frames);
+    if (size != size_)
+      data_.assign(2 * size, 0.0f);
+    else
+      std::fill(data_.begin(), data_.end(), 0.0f);
+    size_ = size;
+    traces_.assign(2 * size_ * extra_traces_, 0.0f);
+    levels_.setCapacity(size, kLevelBaseFrames);
+    head_ = 0;
+    write_pos_.store(0, std::memory_order_relaxed);
+    publish(0, 0, 0.0);
+  }
+
+  size_t capacity() const { return size_; }
+
+  // Rings for n extra traces (at most kMaxExtraTraces). Only while neither
+  // side is using the channel.
+  void setExtraTraces(int n) {
+    extra_traces_ = std::clamp(n, 0, kMaxExtraTraces);
+    traces_.assign(2 * size_ * extra_traces_, 0.0f);
+  }
+  int extraTraces() const { return extra_traces_; }
+
+  static size_t capacityFor(size_t frames) {
+    size_t size = 4 * kMaxUnpublished;
+    while (size < frames)
+      size <<= 1;
+    return size;
+  }
+
+  // Describes the stream as of one publish
+  struct Stamp {
+    size_t end = 0;     // Write position after the block
+    size_t frames = 0;  // Frames in the device callback this block ended
+    size_t trigger = 0; // Newest complete trigger window start, 0 if none
+    double time = 0.0;  // now() when published
+  };
+
+  static double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  // Producer --------------------------------------------------------------
+
+  void write(float left, float right) {
+    float *frame = &data_[2 * (head_ & (size_ - 1))];
+    frame[0] = left;
+    frame[1] = right;
+    levels_.push(left);
+    ++head_;
+  }
+
+  void write(const float *left, const float *right, int num_samples) {
+    for (int i = 0; i < num_samples; ++i)
+      write(left[i], right[i]);
+  }
+
+  // Trace t's sample for the frame the next write() completes
+  void writeTrace(int t, float x, float y) {
+    float *frame = &traces_[2 * (t * size_ + (head_ & (size_ - 1)))];
+    frame[0] = x;
+    frame[1] = y;
+  }
+
+  // Producer-side position, including unpublished samples
+  size_t head() const { return head_; }
+
+  // Make everything written so far visible to the consumer
+  void commit() { write_pos_.store(head_, std::memory_order_release); }
+
+  // Commit and publish a stamp for the device callback that just ended
+  void publish(size_t frames, size_t trigger, double time) {
+    commit();
+    unsigned seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    stamp_end_.store(head_, std::memory_order_relaxed);
+    stamp_frames_.store(frames, std::memory_order_relaxed);
+    stamp_trigger_.store(trigger, std::memory_order_relaxed);
+    stamp_time_.store(time, std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  // Consumer --------------------------------------------------------------
+
+  size_t writePos() const { return write_pos_.load(std::memory_order_acquire); }
+
+  Stamp stamp() const {
+    Stamp s;
+    for (;;) {
+      unsigned seq = seq_.load(std::memory_order_acquire);
+      if (seq & 1)
+        continue;
+      s.end = stamp_end_.load(std::memory_order_relaxed);
+      s.frames = stamp_frames_.load(std::memory_order_relaxed);
+      s.trigger = stamp_trigger_.load(std::memory_order_relaxed);
+      s.time = stamp_time_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) == seq)
+        return s;
+    }
+  }
+
+  // Copy samples [start, start + num_samples). Returns false, leaving the
+  // output unspecified, if part of the window is unpublished or was
+  // overwritten during the copy. right may be null.
+  bool read(size_t start, float *left, float *right, int num_samples) const {
+    if (start + num_samples > writePos() || !retained(start))
+      return false;
+    forEachSpan(start, num_samples, [&](const float *src, int offset, int n) {
+      for (int i = 0; i < n; ++i)
+        left[offset + i] = src[2 * i];
+      if (right)
+        for (int i = 0; i < n; ++i)
+          right[offset + i] = src[2 * i + 1];
+    });
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return retained(start);
+  }
+
+  // As read(), for extra trace t
+  bool readTrace(int t, size_t start, float *x, float *y,
+                 int num_samples) const {
+    if (t >= extra_traces_ || start + num_samples > writePos() ||
+        !retained(start))
+      return false;
+    forEachSpan(start, num_samples, [&](const float *src, int offset, int n) {
+      src = &traces_[2 * t * size_] + (src - data_.data());
+      for (int i = 0; i < n; ++i) {
+        x[offset + i] = src[2 * i];
+        y[offset + i] = src[2 * i + 1];
+      }
+    });
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return retained(start);
+  }
+
+  // As read(), into interleaved L/R pairs (out holds 2 * num_samples floats)
+  bool readInterleaved(size_t start, float *out, int num_samples) const {
+    if (start + num_samples > writePos() || !retained(start))
+      return false;
+    forEachSpan(start, num_samples, [&](const float *src, int offset, int n) {
+      std::memcpy(out + 2 * offset, src, 2 * n * sizeof(float));
+    });
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return retained(start);
+  }
+
+  // Bucket span readLevels() uses for len samples in columns, 0 if the window
+  // is short enough to read sample by sample
+  size_t levelSpan(size_t len, int columns) const {
+    return levels_.spanFor(len, columns);
+  }
+
+  // Reduce the left channel over [start, start + len) to columns min/max
+  // buckets. Fails like read().
+  bool readLevels(size_t start, size_t len, int columns,
+                  LevelPyramid::Bucket *out) const {
+    size_t pos = writePos();
+    if (start + len > pos || !retained(start))
+      return false;
+    levels_.query(start, len, columns, pos, out);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return retained(start);
+  }
+
+private:
+  // Nothing at or after start can have been overwritten yet
+  bool retained(size_t start) const {
+    size_t pos = write_pos_.load(std::memory_order_relaxed);
+    return pos + kMaxUnpublished <= start + size_;
+  }
+
+  // The window split where it wraps: fn(frames, output offset, count)
+  template <typename Fn>
+  void forEachSpan(size_t start, int num_samples, Fn &&fn) const {
+    size_t idx = start & (size_ - 1);
+    int first = static_cast<int>(std::min<size_t>(num_samples, size_ - idx));
+    fn(&data_[2 * idx], 0, first);
+    if (first < num_samples)
+      fn(&data_[0], first, num_samples - first);
+  }
+
+  std::vector<float> data_;   // Interleaved L/R
+  std::vector<float> traces_; // Per extra trace, interleaved X/Y
+  int extra_traces_ = 0;
+  LevelPyramid levels_;
+  size_t size_ = 0;
+  size_t head_ = 0;
+  std::atomic<size_t> write_pos_{0};
+
+  std::atomic<unsigned> seq_{0};
+  std::atomic<size_t> stamp_end_{0};
+  std::atomic<size_t> stamp_frames_{0};
+  std::atomic<size_t> stamp_trigger_{0};
+  std::atomic<double> stamp_time_{0.0};
+};
@@ -24,14 +24,12 @@ public:
     setBeta(0.0);
     setExponent(1);
     // Enable soft clipping to apply tanh saturation at extreme beta
-    osc_x_.setSoftClip(true);
-    osc_y_.setSoftClip(true);
+    osc_.setSoftClip(true);
   }
 
   void setSampleRate(double sr) {
     sample_rate_ = sr;
-    osc_x_.setSampleRate(sr);
-    osc_y_.setSampleRate(sr);
+    osc_.setSampleRate(sr);
     updateFrequencies();
   }
 
@@ -48,58 +46,55 @@ public:
 
   void setBeta(double b) {
     beta_ = std::clamp(b, kMinBeta, kMaxBeta);
-    osc_x_.setBeta(beta_);
-    osc_y_.setBeta(beta_);
+    osc_.setBeta(kX, beta_);
+    osc_.setBeta(kY, beta_);
   }
 
   void setExponent(int e) {
     exponent_ = e;
-    osc_x_.setExponent(e);
-    osc_y_.setExponent(e);
+    osc_.setExponent(e);
   }
 
+  // Precise (double phase and table) or Fast (integer phase, compact table)
+  void setSineCore(dfl::SineCore core) { osc_.setSineCore(core); }
+  dfl::SineCore sineCore() const { return osc_.getSineCore(); }
+
+  double frequency() const { return base_freq_; }
+  double detune() const { return detune_; }
   double beta() const { return beta_; }
   int exponent() const { return exponent_; }
 
   const char* waveformName() const { return "RPM"; }
 
-  // Generate samples into provided buffers
+  // Generate samples into provided buffers (both oscillators in one pass)
   void generate(float* left, float* right, int num_samples) {
-    for (int i = 0; i < num_samples; ++i) {
-      left[i] = static_cast<float>(osc_x_.getSample());
-      right[i] = static_cast<float>(osc_y_.getSample());
-    }
+    if (num_samples <= 0)
+      return;
+    float* out[2] = { left, right };
+    osc_.process(out, num_samples);
+    last_left_ = left[num_samples - 1];
+    last_right_ = right[num_samples - 1];
   }
 
   // Generate a single stereo sample
-  void getSample(float& left, float& right) {
-    left = static_cast<float>(osc_x_.getSample());
-    right = static_cast<float>(osc_y_.getSample());
-    last_left_ = left;
-    last_right_ = right;
-  }
+  void getSample(float& left, float& right) { generate(&left, &right, 1); }
 
-  void reset() {
-    osc_x_.reset();
-    osc_y_.reset();
-  }
+  void reset() { osc_.reset(); }
 
   void setPaused(bool p) { paused_ = p; }
   bool isPaused() const { return paused_; }
   void togglePause() { paused_ = !paused_; }
 
   void advance(int samples) {
-    double s = static_cast<double>(samples);
-    osc_x_.advancePhase(s);
-    osc_y_.advancePhase(s);
+    osc_.advancePhase(static_cast<double>(samples));
   }
 
   void step(int num_samples) {
     if (num_samples > 0) {
-      for (int i = 0; i < num_samples; ++i) {
-        last_left_ = static_cast<float>(osc_x_.getSample());
-        last_right_ = static_cast<float>(osc_y_.getSample());
-      }
+      constexpr int kChunk = 256;
+      float left[kChunk], right[kChunk];
+      for (int done = 0; done < num_samples; done += kChunk)
+        generate(left, right, std::min(kChunk, num_samples - done));
     }
     else {
       // For stateful oscillators, we can't easily go back.
@@ -111,12 +106,14 @@ public:
 
 private:
   void updateFrequencies() {
-    osc_x_.setFrequency(base_freq_);
-    osc_y_.setFrequency(base_freq_ * detune_);
+    osc_.setFrequency(kX, base_freq_);
+    osc_.setFrequency(kY, base_freq_ * detune_);
   }
 
-  dfl::RPMOscillator osc_x_;
-  dfl::RPMOscillator osc_y_;
+  static constexpr int kX = 0;
+  static constexpr int kY = 1;
+
+  dfl::RPMOscillatorBank<2> osc_; // X and Y oscillators as two lanes
   double sample_rate_ = 44100.0;
   double base_freq_ = 80.0;
   double detune_ = 1.003;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "dsp/dfl_FFT.h"
+
+#include <algorithm>
+#include <vector>
+
+// Autocorrelation waveform lock for the triggered sweep
+// Keeps a reference of the last locked sweep and, for each new snapshot of the
+// scope signal, picks the trigger edge whose following window correlates best
+// with it (normalized cross-correlation by FFT). On complex periodic material
+// this lands on the same point of the period every time, where a plain level
+// trigger jumps between edges that cross at the same threshold.
+//
+// Not real-time safe: call from a worker (or the UI thread), never the audio
+// callback.
+class WaveformLocker {
+public:
+  static constexpr int kWindow = 512;  // Reference / displayed sweep length
+  static constexpr int kSearch = 2048; // Newest lags considered per snapshot
+  static constexpr int kSnapshotSize = kSearch + kWindow;
+
+  // Newer candidates within this much correlation of the best one win, which
+  // keeps the lock close to the live signal
+  static constexpr float kNewerBias = 0.02f;
+  // Below this the material has changed: start over from the newest edge
+  static constexpr float kRelockThreshold = 0.3f;
+  static constexpr float kReferenceBlend = 0.2f; // Reference adaption per lock
+
+  WaveformLocker() {
+    reference_.resize(kWindow);
+    correlation_.resize(kSearch + 1);
+    correlator_.prepare(kSnapshotSize);
+  }
+
+  void reset() { has_reference_ = false; }
+
+  // snapshot holds the newest kSnapshotSize samples. Returns the start of the
+  // locked window as an index into snapshot, or -1 if nothing triggered.
+  int update(const float *snapshot, float threshold, bool rising) {
+    int newest_edge = -1;
+    for (int k = kSearch; k >= 1; --k) {
+      if (isEdge(snapshot, k, threshold, rising)) {
+        newest_edge = k;
+        break;
+      }
+    }
+
+    if (!has_reference_) {
+      if (newest_edge < 0)
+        return -1;
+      adopt(snapshot + newest_edge, 1.0f);
+      has_reference_ = true;
+      return newest_edge;
+    }
+
+    int lags = correlator_.process(reference_.data(), kWindow, snapshot,
+                                   kSnapshotSize, correlation_.data());
+
+    // Best correlating edge, then the newest edge that is nearly as good
+    float best = -2.0f;
+    for (int k = 1; k < lags; ++k)
+      if (isEdge(snapshot, k, threshold, rising))
+        best = std::max(best, correlation_[k]);
+
+    int chosen = -1;
+    for (int k = lags - 1; k >= 1 && best > -2.0f; --k) {
+      if (isEdge(snapshot, k, threshold, rising) &&
+          correlation_[k] >= best - kNewerBias) {
+        chosen = k;
+        break;
+      }
+    }
+
+    // No edge at all: fall back to the best lag anywhere
+    if (chosen < 0) {
+      chosen = static_cast<int>(
+          std::max_element(correlation_.begin(), correlation_.begin() + lags) -
+          correlation_.begin());
+      best = correlation_[chosen];
+    }
+
+    if (best < kRelockThreshold) {
+      if (newest_edge < 0)
+        return -1;
+      adopt(snapshot + newest_edge, 1.0f);
+      return newest_edge;
+    }
+
+    adopt(snapshot + chosen, kReferenceBlend);
+    return chosen;
+  }
+
+private:
+  static bool isEdge(const float *s, int k, float threshold, bool rising) {
+    return rising ? (s[k - 1] <= threshold && s[k] > threshold)
+                  : (s[k - 1] >= threshold && s[k] < threshold);
+  }
+
+  // Blend the locked window into the reference so it follows slow changes
+  void adopt(const float *window, float amount) {
+    for (int i = 0; i < kWindow; ++i)
+      reference_[i] += amount * (window[i] - reference_[i]);
+  }
+
+  dfl::CrossCorrelator correlator_;
+  std::vector<float> reference_;
+  std::vector<float> correlation_;
+  bool has_reference_ = false;
+};
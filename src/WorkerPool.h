@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Small fork-join pool for per-frame data parallelism
+// parallelFor() splits work into tasks that idle threads claim one at a time
+// from a shared counter, so a thread that finishes early keeps taking work
+// from the rest. The calling thread runs tasks too and returns when all are
+// done. Never allocates after construction. With no worker threads (e.g. a
+// single-threaded web build) everything runs inline.
+class WorkerPool {
+public:
+  explicit WorkerPool(int num_workers) {
+    for (int i = 0; i < num_workers; ++i)
+      workers_.emplace_back([this] { run(); });
+  }
+
+  ~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &t : workers_)
+      t.join();
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  // Threads taking part in parallelFor, the caller included
+  int concurrency() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Workers to spawn for this machine: one per core, less the caller
+  static int defaultWorkers(int max_workers) {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(0, std::min(cores - 1, max_workers));
+  }
+
+  // Calls fn(task) for every task in [0, num_tasks), in any order and on any
+  // thread. Not reentrant.
+  template <typename Fn>
+  void parallelFor(int num_tasks, Fn &&fn) {
+    if (workers_.empty() || num_tasks <= 1) {
+      for (int i = 0; i < num_tasks; ++i)
+        fn(i);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      using Callable = typename std::remove_reference<Fn>::type;
+      invoke_ = [](void *context, int task) {
+        (*static_cast<Callable *>(context))(task);
+      };
+      context_ = const_cast<void *>(static_cast<const void *>(&fn));
+      num_tasks_ = num_tasks;
+      next_.store(0, std::memory_order_relaxed);
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    work(invoke_, context_, num_tasks);
+
+    // Workers that joined this job must leave it before the job is retired;
+    // any still asleep see it retired and skip it
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&] { return active_ == 0; });
+    num_tasks_ = 0;
+  }
+
+private:
+  using Invoke = void (*)(void *, int);
+
+  // Claim and run tasks until none are left
+  void work(Invoke invoke, void *context, int num_tasks) {
+    for (;;) {
+      int task = next_.fetch_add(1, std::memory_order_relaxed);
+      if (task >= num_tasks)
+        return;
+      invoke(context, task);
+    }
+  }
+
+  void run() {
+    unsigned seen = 0;
+    for (;;) {
+      Invoke invoke;
+      void *context;
+      int num_tasks;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return quit_ || generation_ != seen; });
+        if (quit_)
+          return;
+        seen = generation_;
+        if (num_tasks_ == 0)
+          continue; // That job is already over
+        invoke = invoke_;
+        context = context_;
+        num_tasks = num_tasks_;
+        ++active_;
+      }
+      work(invoke, context, num_tasks);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--active_ == 0)
+        done_.notify_all();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  unsigned generation_ = 0;
+  bool quit_ = false;
+
+  // Current job, published under mutex_ before the wake-up
+  Invoke invoke_ = nullptr;
+  void *context_ = nullptr;
+  int num_tasks_ = 0; // 0 once the job is retired
+  int active_ = 0;    // Workers inside the job
+  std::atomic<int> next_{0};
+};
@@ -0,0 +1,156 @@
+#ifndef dfl_FFT_h
+#define dfl_FFT_h
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace dfl {
+
+  /**
+   * Iterative radix-2 complex FFT with precomputed twiddles and bit-reversal table.
+   *
+   * Sizes must be powers of two. All tables are built by setSize(), so transforms never
+   * allocate. forward() and inverse() run in place; inverse() includes the 1/N scale.
+   */
+
+  class FFT {
+  public:
+    using Complex = std::complex<float>;
+
+    FFT() = default;
+    explicit FFT(int newSize) { setSize(newSize); }
+
+    void setSize(int newSize) {
+      size = newSize;
+      twiddles.resize(size / 2);
+      bitReverse.resize(size);
+
+      const double kTwoPi = 6.283185307179586476925286766559;
+      for (int i = 0; i < size / 2; ++i) {
+        double angle = -kTwoPi * i / size;
+        twiddles[i] = Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+      }
+
+      int bits = 0;
+      while ((1 << bits) < size)
+        ++bits;
+      for (int i = 0; i < size; ++i) {
+        int r = 0;
+        for (int b = 0; b < bits; ++b)
+          r |= ((i >> b) & 1) << (bits - 1 - b);
+        bitReverse[i] = r;
+      }
+    }
+
+    int getSize() const { return size; }
+
+    void forward(Complex* data) const { transform(data, false); }
+
+    void inverse(Complex* data) const {
+      transform(data, true);
+      const float scale = 1.0f / size;
+      for (int i = 0; i < size; ++i)
+        data[i] *= scale;
+    }
+
+  private:
+    void transform(Complex* data, bool inv) const {
+      for (int i = 0; i < size; ++i) {
+        int j = bitReverse[i];
+        if (j > i)
+          std::swap(data[i], data[j]);
+      }
+
+      for (int len = 2; len <= size; len <<= 1) {
+        const int half = len / 2;
+        const int stride = size / len;
+        for (int start = 0; start < size; start += len) {
+          for (int k = 0; k < half; ++k) {
+            Complex w = twiddles[k * stride];
+            if (inv)
+              w = std::conj(w);
+            Complex a = data[start + k];
+            Complex b = data[start + k + half] * w;
+            data[start + k] = a + b;
+            data[start + k + half] = a - b;
+          }
+        }
+      }
+    }
+
+    int size = 0;
+    std::vector<Complex> twiddles;
+    std::vector<int> bitReverse;
+  };
+
+  /**
+   * Normalized cross-correlation of a short reference against a longer signal, via FFT.
+   *
+   *   out[k] = sum_j ref[j] * sig[k + j] / sqrt(sum_j ref[j]^2 * sum_j sig[k + j]^2)
+   *
+   * for k in [0, sigLength - refLength]. Both real inputs are packed into one complex FFT
+   * (ref as the real part, signal as the imaginary part) and separated by conjugate
+   * symmetry, so each call costs one forward and one inverse transform.
+   */
+
+  class CrossCorrelator {
+  public:
+    /** Prepares buffers for signals up to maxSignalLength samples. */
+    void prepare(int maxSignalLength) {
+      int n = 1;
+      while (n < maxSignalLength)
+        n <<= 1;
+      fft.setSize(n);
+      work.assign(n, FFT::Complex());
+      spectrum.assign(n, FFT::Complex());
+      energy.assign(maxSignalLength + 1, 0.0);
+    }
+
+    /** Returns the number of lags written to out (sigLength - refLength + 1), or 0. */
+    int process(const float* ref, int refLength, const float* sig, int sigLength, float* out) {
+      const int n = fft.getSize();
+      if (refLength <= 0 || sigLength < refLength || sigLength > n)
+        return 0;
+
+      for (int i = 0; i < n; ++i)
+        work[i] = FFT::Complex(i < refLength ? ref[i] : 0.0f, i < sigLength ? sig[i] : 0.0f);
+      fft.forward(work.data());
+
+      // Z = R + iS  ->  R[k] = (Z[k] + conj(Z[-k])) / 2,  S[k] = (Z[k] - conj(Z[-k])) / 2i
+      // Correlation spectrum is conj(R) * S
+      for (int k = 0; k < n; ++k) {
+        FFT::Complex z = work[k];
+        FFT::Complex zc = std::conj(work[(n - k) & (n - 1)]);
+        FFT::Complex r = 0.5f * (z + zc);
+        FFT::Complex s = FFT::Complex(0.0f, -0.5f) * (z - zc);
+        spectrum[k] = std::conj(r) * s;
+      }
+      fft.inverse(spectrum.data());
+
+      double refEnergy = 0.0;
+      for (int i = 0; i < refLength; ++i)
+        refEnergy += static_cast<double>(ref[i]) * ref[i];
+
+      energy[0] = 0.0;
+      for (int i = 0; i < sigLength; ++i)
+        energy[i + 1] = energy[i] + static_cast<double>(sig[i]) * sig[i];
+
+      const int lags = sigLength - refLength + 1;
+      for (int k = 0; k < lags; ++k) {
+        double e = (energy[k + refLength] - energy[k]) * refEnergy;
+        out[k] = e > 1e-12 ? static_cast<float>(spectrum[k].real() / std::sqrt(e)) : 0.0f;
+      }
+      return lags;
+    }
+
+  private:
+    FFT fft;
+    std::vector<FFT::Complex> work;
+    std::vector<FFT::Complex> spectrum;
+    std::vector<double> energy;
+  };
+
+}  // end namespace dfl
+
+#endif  // dfl_FFT_h
@@ -6,12 +6,14 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 
 namespace dfl {
 
   //==============================================================================
   // Pade [7/6] approximant (DEFAULT)
-  // Accurate to ~0.0001% for |x| < 5, smooth saturation
+  // Relative error below 1e-6 for |x| < 3, rising to ~0.02% at the +/-5.5
+  // clamp (e.g. 0.01% at 5); smooth saturation
   // Same as JUCE FastMathApproximations::tanh
   //==============================================================================
   inline float fastTanh(float x) noexcept {
@@ -255,6 +257,9 @@ namespace dfl {
       return table[index & TABLE_SIZE];  // Mask for safety
     }
 
+    /** Raw table (TABLE_SIZE + 1 entries) for batch kernels that wrap phase themselves. */
+    inline const double* data() const noexcept { return table.data(); }
+
   private:
     std::array<double, TABLE_SIZE + 1> table;
   };
@@ -276,4 +281,76 @@ namespace dfl {
     return getSineLUT().sinRadians(radians);
   }
 
+  //==============================================================================
+  // Compact sine table for fixed-point phase
+  // 2048 floats + guard (8 KB, stays in L1), built at compile time: no startup
+  // cost. Phase is an unsigned 32-bit fraction of a cycle, so an accumulator
+  // wraps for free; the top 11 bits index the table and the rest interpolate.
+  // Linear interpolation error is below 1.2e-6 (~-118 dB).
+  //==============================================================================
+
+  // Which sine an oscillator core uses: the double SineLUT on a double phase, or
+  // FastSineTable on a 32-bit integer phase accumulator
+  enum class SineCore { Precise, Fast };
+
+  namespace detail {
+    constexpr int kFastSineBits = 11;
+
+    struct FastSineData {
+      float v[(1u << kFastSineBits) + 1];
+    };
+
+    // Taylor series on [-π, π]; terms past x^31 are below double precision
+    constexpr double sinTaylor(double x) {
+      double term = x, sum = x;
+      for (int k = 1; k < 16; ++k) {
+        term *= -x * x / ((2 * k) * (2 * k + 1));
+        sum += term;
+      }
+      return sum;
+    }
+
+    constexpr FastSineData buildFastSine() {
+      constexpr double kPi = 3.14159265358979323846;
+      constexpr uint32_t kSize = 1u << kFastSineBits;
+      FastSineData t{};
+      for (uint32_t i = 0; i <= kSize; ++i) {
+        double x = 2.0 * kPi * static_cast<double>(i) / kSize;
+        if (x > kPi)
+          x -= 2.0 * kPi;
+        t.v[i] = static_cast<float>(sinTaylor(x));
+      }
+      return t;
+    }
+
+    inline constexpr FastSineData kFastSine = buildFastSine();
+  }  // namespace detail
+
+  class FastSineTable {
+  public:
+    static constexpr int kBits = detail::kFastSineBits;
+    static constexpr uint32_t kSize = 1u << kBits;
+    static constexpr int kFracBits = 32 - kBits;
+
+    /** sin(2π * phase / 2^32) */
+    static inline float lookup(uint32_t phase) noexcept {
+      const float* table = detail::kFastSine.v;
+      const uint32_t index = phase >> kFracBits;
+      const float frac = static_cast<float>(phase & ((1u << kFracBits) - 1)) *
+                         (1.0f / static_cast<float>(1u << kFracBits));
+      const float a = table[index];
+      return a + frac * (table[index + 1] - a);
+    }
+
+    /** Fixed-point phase for a phase in cycles (any sign or size; wraps). */
+    static inline uint32_t toPhase(double cycles) noexcept {
+      return static_cast<uint32_t>(static_cast<int64_t>(cycles * 4294967296.0));
+    }
+
+    /** Phase in cycles [0, 1) for a fixed-point phase. */
+    static inline double toCycles(uint32_t phase) noexcept {
+      return static_cast<double>(phase) * (1.0 / 4294967296.0);
+    }
+  };
+
 }  // namespace dfl
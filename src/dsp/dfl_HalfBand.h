@@ -0,0 +1,155 @@
+#ifndef dfl_HalfBand_h
+#define dfl_HalfBand_h
+
+#include <algorithm>
+#include <cmath>
+
+namespace dfl {
+
+  /**
+   * Linear-phase half-band FIR with polyphase 2x up/down sampling.
+   *
+   * Every even tap except the centre one of a half-band filter is zero, so each
+   * output sample needs only K multiplies (symmetric odd taps folded in pairs)
+   * and the other polyphase branch is a pure delay.
+   *
+   * Taps are a Blackman-windowed sinc with 4K - 1 taps, normalised to unity DC
+   * gain. K = 16 keeps the passband flat to 0.4 * fs_low with 60-75 dB of
+   * image rejection.
+   *
+   * Latency: K samples at the low rate through up(), K - 0.5 through down().
+   */
+
+  template <int K>
+  class HalfBandFilter {
+  public:
+    HalfBandFilter() {
+      constexpr double kPi = 3.14159265358979323846;
+      const int half = 2 * K - 1;  // Outermost nonzero tap index
+      double sum = 0.0;
+      for (int i = 1; i <= K; ++i) {
+        const int n = 2 * i - 1;
+        const double sinc = std::sin(kPi * n * 0.5) / (kPi * n * 0.5);
+        const double t = kPi * (n + half + 1) / (half + 1);
+        const double window = 0.42 - 0.5 * std::cos(t) + 0.08 * std::cos(2.0 * t);
+        taps_[i - 1] = 0.5 * sinc * window;
+        sum += taps_[i - 1];
+      }
+      // Odd taps on both sides plus the 0.5 centre tap sum to 1
+      for (double& tap : taps_)
+        tap *= 0.25 / sum;
+      reset();
+    }
+
+    void reset() {
+      std::fill(up_hist_, up_hist_ + 2 * kLen, 0.0f);
+      std::fill(down_odd_, down_odd_ + 2 * kLen, 0.0f);
+      std::fill(down_even_, down_even_ + 2 * kLen, 0.0f);
+      up_pos_ = down_pos_ = down_pos_even_ = 0;
+    }
+
+    /** Upsample in[0..n) into out[0..2n). */
+    void up(const float* in, float* out, int n) {
+      for (int i = 0; i < n; ++i) {
+        const float* h = push(up_hist_, up_pos_, in[i]);
+        out[2 * i] = h[K];
+        out[2 * i + 1] = static_cast<float>(2.0 * fold(h));
+      }
+    }
+
+    /** Downsample in[0..2n) into out[0..n). */
+    void down(const float* in, float* out, int n) {
+      for (int i = 0; i < n; ++i) {
+        const float* e = push(down_even_, down_pos_even_, in[2 * i]);
+        const float* h = push(down_odd_, down_pos_, in[2 * i + 1]);
+        out[i] = static_cast<float>(0.5 * e[K - 1] + fold(h));
+      }
+    }
+
+  private:
+    static constexpr int kLen = 2 * K;
+
+    // Circular history stored twice so the newest kLen samples are always
+    // contiguous: h[0] is the newest, h[kLen - 1] the oldest.
+    static const float* push(float* hist, int& pos, float x) {
+      pos = (pos == 0) ? kLen - 1 : pos - 1;
+      hist[pos] = hist[pos + kLen] = x;
+      return hist + pos;
+    }
+
+    // Symmetric odd taps: taps_[i - 1] pairs h[K - i] with h[K - 1 + i]
+    double fold(const float* h) const {
+      double acc = 0.0;
+      for (int i = 1; i <= K; ++i)
+        acc += taps_[i - 1] * (static_cast<double>(h[K - i]) + h[K - 1 + i]);
+      return acc;
+    }
+
+    double taps_[K];
+    float up_hist_[2 * kLen];
+    float down_odd_[2 * kLen];
+    float down_even_[2 * kLen];
+    int up_pos_ = 0;
+    int down_pos_ = 0;
+    int down_pos_even_ = 0;
+  };
+
+  /**
+   * 1x/2x/4x oversampler built from cascaded half-band stages.
+   *
+   * The first stage (adjacent to the base rate) carries the steep transition
+   * band; the second stage at 2x only has to reject images above the original
+   * Nyquist band, so it uses a much shorter kernel.
+   *
+   * Block-based: up() returns factor * n samples, down() consumes them.
+   * Each direction keeps its own state, so one instance handles one signal path.
+   */
+
+  class Oversampler {
+  public:
+    static constexpr int kMaxFactor = 4;
+
+    void setFactor(int factor) {
+      factor_ = (factor >= 4) ? 4 : (factor >= 2 ? 2 : 1);
+      reset();
+    }
+    int factor() const { return factor_; }
+
+    void reset() {
+      stage1_.reset();
+      stage2_.reset();
+    }
+
+    /** in[0..n) -> out[0..n * factor). out must not alias in. */
+    void up(const float* in, float* out, int n) {
+      if (factor_ == 1) {
+        std::copy(in, in + n, out);
+      } else if (factor_ == 2) {
+        stage1_.up(in, out, n);
+      } else {
+        stage1_.up(in, out + 2 * n, n);  // Park 2x signal in the upper half
+        stage2_.up(out + 2 * n, out, 2 * n);
+      }
+    }
+
+    /** in[0..n * factor) -> out[0..n). Overwrites in at 4x. */
+    void down(float* in, float* out, int n) {
+      if (factor_ == 1) {
+        std::copy(in, in + n, out);
+      } else if (factor_ == 2) {
+        stage1_.down(in, out, n);
+      } else {
+        stage2_.down(in, in, 2 * n);  // In place: writes trail reads
+        stage1_.down(in, out, n);
+      }
+    }
+
+  private:
+    int factor_ = 1;
+    HalfBandFilter<16> stage1_;
+    HalfBandFilter<6> stage2_;
+  };
+
+} // namespace dfl
+
+#endif // dfl_HalfBand_h
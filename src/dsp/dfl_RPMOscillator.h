@@ -34,6 +34,10 @@ namespace dfl {
    *   - High |beta|: noise/chaos (use softClip to tame)
    *
    * Use setSawMode() and setSquareMode() for convenient presets.
+   *
+   * setSineCore(SineCore::Fast) switches getSample() to a 32-bit integer phase accumulator
+   * and the compile-time FastSineTable (wrap for free, 8 KB table); the default Precise core
+   * uses a double phase and the double SineLUT.
    */
 
   class RPMOscillator {
@@ -52,6 +56,9 @@ namespace dfl {
       state = 0.0;  // filtered feedback state
       lastOut = 0.0;  // previous output sample
       softClip = false;  // optional tanh limiting on feedback
+      phaseFixed = 0;
+      incrementFixed = 0;
+      core = SineCore::Precise;
     }
 
     ~RPMOscillator() { }
@@ -111,6 +118,19 @@ namespace dfl {
     /** Returns whether soft clipping is enabled. */
     bool getSoftClip() const { return softClip; }
 
+    /** Selects the sine and phase implementation; the phase carries over. */
+    void setSineCore(SineCore newCore) {
+      if (newCore == core)
+        return;
+      if (newCore == SineCore::Fast)
+        phaseFixed = FastSineTable::toPhase(phase);
+      else
+        phase = FastSineTable::toCycles(phaseFixed);
+      core = newCore;
+    }
+
+    SineCore getSineCore() const { return core; }
+
     //---------------------------------------------------------------------------------------------
     // presets:
 
@@ -146,33 +166,38 @@ namespace dfl {
      * @return Output sample (-1.0 to 1.0)
      */
     INLINE double process(double phaseIn) {
-      // Update feedback state with one-pole "bunting" filter
-      state = 0.5 * (state + fastPow(lastOut, exponent));
-
-      // Optional soft clipping to tame runaway feedback at high beta
-      if (softClip)
-        state = dfl::fastTanh(state);
+      updateState();
 
       // Generate output: sine of (input phase + feedback modulation)
       // Using LUT: convert modulated radians back to normalized phase
       double modulatedPhase = phaseIn + (beta * state) / TWO_PI;
-      lastOut = dfl::fastSin(modulatedPhase);
-
-      // Apply soft clipping to output to tame extreme values
-      if (softClip)
-        lastOut = dfl::fastTanh(lastOut);
+      if (core == SineCore::Fast)
+        lastOut = FastSineTable::lookup(FastSineTable::toPhase(modulatedPhase));
+      else
+        lastOut = dfl::fastSin(modulatedPhase);
 
-      return lastOut;
+      return shapeOutput();
     }
 
     /** Calculates the phase increment based on frequency and sample rate. */
-    INLINE void calculateIncrement() { increment = freq * sampleRateRec; }
+    INLINE void calculateIncrement() {
+      increment = freq * sampleRateRec;
+      incrementFixed = FastSineTable::toPhase(increment);
+    }
 
     /**
      * Generates one output sample using internal phase accumulator.
      * Convenience method when you don't have an external phasor.
      */
     INLINE double getSample() {
+      if (core == SineCore::Fast) {
+        updateState();
+        lastOut = FastSineTable::lookup(phaseFixed +
+                                        FastSineTable::toPhase((beta * state) / TWO_PI));
+        phaseFixed += incrementFixed;  // Wraps by overflow
+        return shapeOutput();
+      }
+
       double out = process(phase);
 
       // Advance internal phase with wraparound
@@ -186,12 +211,16 @@ namespace dfl {
     /** Resets the oscillator state (phase, feedback state, and last output). */
     void reset() {
       phase = 0.0;
+      phaseFixed = 0;
       state = 0.0;
       lastOut = 0.0;
     }
 
     /** Resets only the phase accumulator to zero. */
-    void resetPhase() { phase = 0.0; }
+    void resetPhase() {
+      phase = 0.0;
+      phaseFixed = 0;
+    }
 
     /** Sets the phase directly (0.0 to 1.0). */
     void setPhase(double newPhase) {
@@ -200,10 +229,16 @@ namespace dfl {
         phase -= 1.0;
       while (phase < 0.0)
         phase += 1.0;
+      phaseFixed = FastSineTable::toPhase(phase);
     }
 
     /** Advances (or retards) phase by a number of samples. */
     void advancePhase(double numSamples) {
+      if (core == SineCore::Fast) {
+        const double cycles = increment * numSamples;
+        phaseFixed += FastSineTable::toPhase(cycles - std::floor(cycles));
+        return;
+      }
       phase += increment * numSamples;
       while (phase >= 1.0)
         phase -= 1.0;
@@ -214,6 +249,21 @@ namespace dfl {
     //=============================================================================================
 
   protected:
+    // Feedback state: one-pole "bunting" filter, optionally soft-clipped to tame
+    // runaway feedback at high beta
+    INLINE void updateState() {
+      state = 0.5 * (state + fastPow(lastOut, exponent));
+      if (softClip)
+        state = dfl::fastTanh(state);
+    }
+
+    // Apply soft clipping to output to tame extreme values
+    INLINE double shapeOutput() {
+      if (softClip)
+        lastOut = dfl::fastTanh(lastOut);
+      return lastOut;
+    }
+
     // Fast power function for integer exponents
     INLINE double fastPow(double base, int exp) {
       if (exp == 1)
@@ -240,6 +290,254 @@ namespace dfl {
     double state;  // one-pole filtered feedback state
     double lastOut;  // previous output sample
     bool softClip;  // enable tanh limiting on feedback state
+    uint32_t phaseFixed;  // phase as a 32-bit fraction of a cycle (Fast core)
+    uint32_t incrementFixed;
+    SineCore core;
+  };
+
+  /**
+   * Several RPM oscillators stepped together, for block rendering.
+   *
+   * State is held as struct-of-arrays with one lane per oscillator. Each lane has its own
+   * frequency, beta, phase and feedback state; the exponent and soft-clip setting are shared.
+   * The lane loop runs innermost with a fixed trip count, so the independent feedback
+   * recursions interleave and their arithmetic packs into SIMD registers (two doubles per
+   * SSE2/NEON/WASM SIMD register). Each lane's one-sample recursion is unchanged, and so is the
+   * output: it matches RPMOscillator::getSample() sample for sample.
+   *
+   * The exponent, soft-clip and sine-core branches are resolved once per block, not once per
+   * sample. With SineCore::Fast the lanes step 32-bit integer phases into FastSineTable, as
+   * RPMOscillator's fast core does.
+   */
+
+  template <int NumLanes>
+  class RPMOscillatorBank {
+  public:
+    RPMOscillatorBank() {
+      for (int i = 0; i < NumLanes; ++i) {
+        freq[i] = 440.0;
+        beta[i] = 1.0;
+      }
+      setSampleRate(44100.0);
+      reset();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // parameter settings:
+
+    void setSampleRate(double newSampleRate) {
+      if (newSampleRate > 0.0) {
+        sampleRateRec = 1.0 / newSampleRate;
+        for (int i = 0; i < NumLanes; ++i) {
+          increment[i] = freq[i] * sampleRateRec;
+          incrementFixed[i] = FastSineTable::toPhase(increment[i]);
+        }
+      }
+    }
+
+    void setFrequency(int lane, double newFrequency) {
+      if ((newFrequency > 0.0) && (newFrequency < 20000.0)) {
+        freq[lane] = newFrequency;
+        increment[lane] = newFrequency * sampleRateRec;
+        incrementFixed[lane] = FastSineTable::toPhase(increment[lane]);
+      }
+    }
+
+    void setBeta(int lane, double newBeta) { beta[lane] = newBeta; }
+
+    void setExponent(int newExponent) {
+      if (newExponent >= 1)
+        exponent = newExponent;
+    }
+
+    void setSoftClip(bool enabled) { softClip = enabled; }
+
+    /** Selects the sine and phase implementation; phases carry over. */
+    void setSineCore(SineCore newCore) {
+      if (newCore == core)
+        return;
+      for (int i = 0; i < NumLanes; ++i) {
+        if (newCore == SineCore::Fast)
+          phaseFixed[i] = FastSineTable::toPhase(phase[i]);
+        else
+          phase[i] = FastSineTable::toCycles(phaseFixed[i]);
+      }
+      core = newCore;
+    }
+
+    SineCore getSineCore() const { return core; }
+
+    //---------------------------------------------------------------------------------------------
+    // audio processing:
+
+    /** Renders numSamples per lane into out[lane][0..numSamples). */
+    void process(float* const* out, int numSamples) {
+      if (softClip)
+        processWithClip<true>(out, numSamples);
+      else
+        processWithClip<false>(out, numSamples);
+    }
+
+    void reset() {
+      for (int i = 0; i < NumLanes; ++i) {
+        phase[i] = state[i] = lastOut[i] = 0.0;
+        phaseFixed[i] = 0;
+      }
+    }
+
+    /** Advances (or retards) every lane's phase by a number of samples. */
+    void advancePhase(double numSamples) {
+      for (int i = 0; i < NumLanes; ++i) {
+        phase[i] += increment[i] * numSamples;
+        phase[i] -= std::floor(phase[i]);
+        const double cycles = increment[i] * numSamples;
+        phaseFixed[i] += FastSineTable::toPhase(cycles - std::floor(cycles));
+      }
+    }
+
+    //=============================================================================================
+
+  protected:
+    template <bool Clip>
+    void processWithClip(float* const* out, int numSamples) {
+      if (core == SineCore::Fast)
+        processWithCore<Clip, true>(out, numSamples);
+      else
+        processWithCore<Clip, false>(out, numSamples);
+    }
+
+    template <bool Clip, bool Fast>
+    void processWithCore(float* const* out, int numSamples) {
+      switch (exponent) {
+      case 1: processBlock<1, Clip, Fast>(out, numSamples); break;
+      case 2: processBlock<2, Clip, Fast>(out, numSamples); break;
+      case 3: processBlock<3, Clip, Fast>(out, numSamples); break;
+      case 4: processBlock<4, Clip, Fast>(out, numSamples); break;
+      default: processBlock<0, Clip, Fast>(out, numSamples); break;
+      }
+    }
+
+    template <int Exp>
+    double power(double base) const {
+      if constexpr (Exp == 1)
+        return base;
+      else if constexpr (Exp == 2)
+        return base * base;
+      else if constexpr (Exp == 3)
+        return base * base * base;
+      else if constexpr (Exp == 4) {
+        double sq = base * base;
+        return sq * sq;
+      }
+      else
+        return std::pow(base, exponent);
+    }
+
+    // Exp == 0 selects the std::pow fallback for exponents above 4
+    template <int Exp, bool Clip, bool Fast>
+    void processBlock(float* const* out, int numSamples) {
+      if constexpr (Fast) {
+        processBlockFast<Exp, Clip>(out, numSamples);
+        return;
+      }
+      constexpr int kTableSize = static_cast<int>(SineLUT::TABLE_SIZE);
+      const double* table = getSineLUT().data();
+
+      double ph[NumLanes], inc[NumLanes], st[NumLanes], last[NumLanes], bt[NumLanes];
+      for (int i = 0; i < NumLanes; ++i) {
+        ph[i] = phase[i];
+        inc[i] = increment[i];
+        st[i] = state[i];
+        last[i] = lastOut[i];
+        bt[i] = beta[i];
+      }
+
+      for (int n = 0; n < numSamples; ++n) {
+        for (int i = 0; i < NumLanes; ++i) {
+          // Feedback state: one-pole "bunting" filter
+          double s = 0.5 * (st[i] + power<Exp>(last[i]));
+          if constexpr (Clip)
+            s = dfl::fastTanh(s);
+          st[i] = s;
+
+          // Sine LUT with the wrap folded in. A phase just below an integer can
+          // round up to exactly TABLE_SIZE; frac is then 0 and the mask maps it to
+          // entry 0, which holds the same value.
+          double p = ph[i] + (bt[i] * s) / TWO_PI;
+          double whole = static_cast<double>(static_cast<long long>(p));
+          whole -= (whole > p) ? 1.0 : 0.0;  // floor() without the libm call
+          double scaled = (p - whole) * kTableSize;
+          int index = static_cast<int>(scaled);
+          double frac = scaled - index;
+          index &= kTableSize - 1;
+          double y = table[index] + frac * (table[index + 1] - table[index]);
+          if constexpr (Clip)
+            y = dfl::fastTanh(y);
+          last[i] = y;
+          out[i][n] = static_cast<float>(y);
+
+          // Branchless phase wrap (increment < 1)
+          ph[i] += inc[i];
+          ph[i] -= (ph[i] >= 1.0) ? 1.0 : 0.0;
+        }
+      }
+
+      for (int i = 0; i < NumLanes; ++i) {
+        phase[i] = ph[i];
+        state[i] = st[i];
+        lastOut[i] = last[i];
+      }
+    }
+
+    // Fast core: integer phases wrap by overflow, and the feedback term is added
+    // as a fixed-point phase offset
+    template <int Exp, bool Clip>
+    void processBlockFast(float* const* out, int numSamples) {
+      uint32_t ph[NumLanes], inc[NumLanes];
+      double st[NumLanes], last[NumLanes], bt[NumLanes];
+      for (int i = 0; i < NumLanes; ++i) {
+        ph[i] = phaseFixed[i];
+        inc[i] = incrementFixed[i];
+        st[i] = state[i];
+        last[i] = lastOut[i];
+        bt[i] = beta[i] / TWO_PI;
+      }
+
+      for (int n = 0; n < numSamples; ++n) {
+        for (int i = 0; i < NumLanes; ++i) {
+          double s = 0.5 * (st[i] + power<Exp>(last[i]));
+          if constexpr (Clip)
+            s = dfl::fastTanh(s);
+          st[i] = s;
+
+          double y = FastSineTable::lookup(ph[i] + FastSineTable::toPhase(bt[i] * s));
+          if constexpr (Clip)
+            y = dfl::fastTanh(y);
+          last[i] = y;
+          out[i][n] = static_cast<float>(y);
+          ph[i] += inc[i];
+        }
+      }
+
+      for (int i = 0; i < NumLanes; ++i) {
+        phaseFixed[i] = ph[i];
+        state[i] = st[i];
+        lastOut[i] = last[i];
+      }
+    }
+
+    double sampleRateRec = 1.0 / 44100.0;
+    double freq[NumLanes];
+    double increment[NumLanes];
+    double beta[NumLanes];
+    double phase[NumLanes];
+    double state[NumLanes];
+    double lastOut[NumLanes];
+    uint32_t phaseFixed[NumLanes];  // Fast core phases, 32-bit fractions of a cycle
+    uint32_t incrementFixed[NumLanes];
+    int exponent = 1;
+    bool softClip = false;
+    SineCore core = SineCore::Precise;
   };
 
 }  // end namespace dfl
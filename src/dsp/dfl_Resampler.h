@@ -0,0 +1,223 @@
+#ifndef dfl_Resampler_h
+#define dfl_Resampler_h
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace dfl {
+
+  /**
+   * Streaming stereo sample-rate converter: Kaiser-windowed sinc, polyphase.
+   *
+   * The kernel is tabulated at kPhases fractional offsets (plus one, so the table can
+   * be interpolated linearly between neighbouring phases), each row a fixed number of
+   * contiguous floats: kMinTaps, stretched by the ratio when downsampling so the
+   * transition band keeps its width at the lower rate. An output sample blends two rows
+   * and takes one fixed-length dot product per channel, a loop written with independent
+   * partial sums so it vectorizes.
+   *
+   * When downsampling, the cutoff follows the lower rate, so content above the new
+   * Nyquist is filtered out and does not alias. Everything is computed by setRates();
+   * process() does not allocate, and its cost per output sample is constant.
+   *
+   * Input is pulled as needed through a callback: fill(left, right, count).
+   * Latency: getLatency() input samples.
+   *
+   * processChannels() runs any number of channels (up to setChannels()) through the
+   * same kernel: the phase blend is computed once per output sample and shared, so
+   * each extra channel costs one dot product. Channels are stored as separate rows
+   * (structure of arrays), and fill receives one pointer per channel.
+   */
+
+  class Resampler {
+  public:
+    static constexpr int kMinTaps = 48;
+    static constexpr int kPhases = 256;
+    static constexpr int kChunk = 256;  // Input frames pulled per fill
+
+    Resampler() { setRates(44100.0, 44100.0); }
+
+    void setRates(double sourceRate, double targetRate) {
+      ratio = sourceRate / targetRate;
+      const double kPi = 3.14159265358979323846;
+      const double cutoff = kPassband * std::min(1.0, 1.0 / ratio);
+      const double beta = 8.0;
+
+      taps = static_cast<int>(std::ceil(kMinTaps * std::max(1.0, ratio) / kLanes)) * kLanes;
+      const double centre = taps / 2 - 1;
+      table.assign((kPhases + 1) * taps, 0.0f);
+      std::vector<double> row(taps);
+      for (int p = 0; p <= kPhases; ++p) {
+        const double frac = static_cast<double>(p) / kPhases;
+        double sum = 0.0;
+        for (int j = 0; j < taps; ++j) {
+          const double x = j - centre - frac;
+          const double arg = kPi * cutoff * x;
+          const double sinc = std::abs(arg) < 1e-9 ? 1.0 : std::sin(arg) / arg;
+          const double w = x / (taps / 2);
+          const double window = std::abs(w) >= 1.0 ? 0.0 : besselI0(beta * std::sqrt(1.0 - w * w));
+          row[j] = sinc * window;
+          sum += row[j];
+        }
+        for (int j = 0; j < taps; ++j)
+          table[p * taps + j] = static_cast<float>(row[j] / sum);
+      }
+
+      kernel.assign(taps, 0.0f);
+      allocate();
+    }
+
+    /** Channels the buffers hold (2 by default). Reallocates, so not while processing. */
+    void setChannels(int numChannels) {
+      channels = std::clamp(numChannels, 2, kMaxChannels);
+      allocate();
+    }
+    int getChannels() const { return channels; }
+
+    double getRatio() const { return ratio; }
+    int getLatency() const { return taps / 2; }
+    /** Source frames fill() has supplied beyond the one the next output frame is centred on. */
+    int getLookahead() const { return count - pos - taps / 2; }
+    bool isIdentity() const { return ratio == 1.0; }
+
+    void reset() {
+      std::fill(buffer.begin(), buffer.end(), 0.0f);
+      count = taps - 1;  // Start on a zero history
+      pos = 0;
+      frac = 0.0;
+    }
+
+    template <typename Fill>
+    void process(float* outLeft, float* outRight, int numFrames, Fill&& fill) {
+      auto fillRows = [&](float* const* in, int n) { fill(in[0], in[1], n); };
+      for (int i = 0; i < numFrames; ++i) {
+        if (pos + taps > count)
+          refill(fillRows, 2);
+
+        const double phase = frac * kPhases;
+        const int p = static_cast<int>(phase);
+        const float t = static_cast<float>(phase - p);
+        const float* a = &table[p * taps];
+        const float* b = a + taps;
+        const float* l = row(0) + pos;
+        const float* r = row(1) + pos;
+
+        float accL[kLanes] = {}, accR[kLanes] = {};
+        for (int j = 0; j < taps; j += kLanes) {
+          for (int k = 0; k < kLanes; ++k) {
+            const float c = a[j + k] + t * (b[j + k] - a[j + k]);
+            accL[k] += c * l[j + k];
+            accR[k] += c * r[j + k];
+          }
+        }
+        float sumL = 0.0f, sumR = 0.0f;
+        for (int k = 0; k < kLanes; ++k) {
+          sumL += accL[k];
+          sumR += accR[k];
+        }
+        outLeft[i] = sumL;
+        outRight[i] = sumR;
+        advance();
+      }
+    }
+
+    /**
+     * out holds numChannels (at most getChannels()) output rows; fill(in, count) writes
+     * count frames to each of the numChannels rows in[]. Rows the previous calls did
+     * not use start from whatever they last held, so a channel joining mid-stream has
+     * one window of stale history.
+     */
+    template <typename Fill>
+    void processChannels(float* const* out, int numChannels, int numFrames, Fill&& fill) {
+      numChannels = std::min(numChannels, channels);
+      for (int i = 0; i < numFrames; ++i) {
+        if (pos + taps > count)
+          refill(fill, numChannels);
+
+        const double phase = frac * kPhases;
+        const int p = static_cast<int>(phase);
+        const float t = static_cast<float>(phase - p);
+        const float* a = &table[p * taps];
+        const float* b = a + taps;
+        for (int j = 0; j < taps; ++j)
+          kernel[j] = a[j] + t * (b[j] - a[j]);
+
+        for (int ch = 0; ch < numChannels; ++ch) {
+          const float* x = row(ch) + pos;
+          float acc[kLanes] = {};
+          for (int j = 0; j < taps; j += kLanes)
+            for (int k = 0; k < kLanes; ++k)
+              acc[k] += kernel[j + k] * x[j + k];
+          float sum = 0.0f;
+          for (int k = 0; k < kLanes; ++k)
+            sum += acc[k];
+          out[ch][i] = sum;
+        }
+        advance();
+      }
+    }
+
+  private:
+    static constexpr double kPassband = 0.92;  // Of the lower Nyquist
+    static constexpr int kLanes = 8;
+
+    static double besselI0(double x) {
+      double sum = 1.0, term = 1.0;
+      for (int k = 1; k < 32; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+      }
+      return sum;
+    }
+
+    static constexpr int kMaxChannels = 16;
+
+    float* row(int ch) { return &buffer[static_cast<size_t>(ch) * stride]; }
+
+    void allocate() {
+      stride = taps + kChunk;
+      buffer.assign(static_cast<size_t>(channels) * stride, 0.0f);
+      reset();
+    }
+
+    void advance() {
+      frac += ratio;
+      const int step = static_cast<int>(frac);
+      pos += step;
+      frac -= step;
+    }
+
+    // Drop consumed input, keeping the window, and pull the next chunk
+    template <typename Fill>
+    void refill(Fill& fill, int numChannels) {
+      const int keep = count - std::min(pos, count);
+      float* in[kMaxChannels];
+      numChannels = std::min(numChannels, kMaxChannels);
+      for (int ch = 0; ch < numChannels; ++ch) {
+        float* r = row(ch);
+        std::copy(r + (count - keep), r + count, r);
+        in[ch] = r + keep;
+      }
+      pos -= count - keep;
+      count = keep;
+      const int n = stride - count;
+      fill(static_cast<float* const*>(in), n);
+      count += n;
+    }
+
+    double ratio = 1.0;
+    int taps = kMinTaps;
+    int channels = 2;
+    int stride = 0;
+    std::vector<float> table;
+    std::vector<float> kernel;  // Phase-blended kernel row (processChannels)
+    std::vector<float> buffer;  // channels rows of stride input frames
+    int count = 0;  // Valid input frames in the buffer
+    int pos = 0;    // First input frame of the current window
+    double frac = 0.0;
+  };
+
+}  // end namespace dfl
+
+#endif  // dfl_Resampler_h
@@ -22,26 +22,55 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include "AudioData.h"
+#include "BeamSplatter.h"
+#include "BetaDensity.h"
 #include "FilterJoystick.h"
 #include "FilterMorpher.h"
+#include "FrameSink.h"
+#include "LevelPyramid.h"
+#include "ParamQueue.h"
+#include "PostChain.h"
+#include "Profiler.h"
+#include "QualityGovernor.h"
+#include "ScopeChain.h"
+#include "ScopeChannel.h"
 #include "TestSignalGenerator.h"
+#include "WaveformLocker.h"
+#include "WorkerPool.h"
+#include "dsp/dfl_Resampler.h"
 #include "embedded/faveworm_fonts.h"
 #include "embedded/faveworm_shaders.h"
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
 #include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
-#include <fstream>
+#include <functional>
+#include <limits>
 #include <mutex>
 #include <thread>
 #include <vector>
 #include <visage/app.h>
 #include <visage_ui/scroll_bar.h>
 
+#if !VISAGE_EMSCRIPTEN
+// PNG frames for --render; static so it cannot clash with visage's own copy
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#endif
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
 // Global constants for parameter ranges
 static constexpr float kMinFilterCutoff = 20.0f;
 static constexpr float kMaxFilterCutoff = 3000.0f;
@@ -91,6 +120,28 @@ static constexpr float kMinLfoDepth = 0.0f;     // No modulation
 static constexpr float kMaxLfoDepth = 4.0f;     // 4 octaves max
 static constexpr float kDefaultLfoDepth = 0.0f; // Default: no modulation
 
+// Parameters the audio thread reads, by ID (see AudioPlayer::setParam)
+enum AudioParam {
+  kParamVolume,
+  kParamCutoff,
+  kParamResonance,
+  kParamPreGain,
+  kParamLfoFreq,
+  kParamLfoDepth,
+  kNumAudioParams
+};
+
+static constexpr ParamSpec kAudioParamSpecs[kNumAudioParams] = {
+    // Volume already ramps per sample in processBlock
+    {kMinVolume, kMaxVolume, kDefaultVolume, 0.0f, false},
+    {kMinFilterCutoff, kMaxFilterCutoff, kDefaultFilterCutoff, 30.0f, true},
+    {kMinFilterResonance, kMaxFilterResonance, kDefaultFilterResonance, 30.0f,
+     false},
+    {kMinPreGain, kMaxPreGain, kDefaultPreGain, 20.0f, false},
+    {kMinLfoFreq, kMaxLfoFreq, kDefaultLfoFreq, 50.0f, true},
+    {kMinLfoDepth, kMaxLfoDepth, kDefaultLfoDepth, 50.0f, false},
+};
+
 // Rendering step multiplier (1.0 = base, higher = coarser/faster rendering)
 static constexpr float kDefaultStepMult = 1.0f;
 static constexpr float kMinStepMult = 0.5f;
@@ -163,22 +214,29 @@ public:
     drawSection("General");
     drawKey("H / ?", "Toggle this help");
     drawKey("G", "Toggle grid");
+    drawKey("A", "Toggle analytic beam");
+    drawKey("F1", "Toggle profiler HUD");
+    drawKey("Shift+F1", "Write faveworm_profile.csv/.json");
     drawKey(", / .", "Step back / forward (when frozen)");
     y += 10;
 
     drawSection("Audio");
     drawKey("Space", "Play/pause audio");
     drawKey("M", "Mute/unmute");
+    drawKey("I", "Toggle live input");
+    drawKey("Shift+I", "Next input device");
     y += 10;
 
     drawSection("Trigger Mode");
     drawKey("L", "Toggle waveform lock");
     drawKey("E", "Toggle trigger edge");
     drawKey("Shift+Up/Dn", "Adjust threshold");
+    drawKey("Left/Right", "Shorter / longer timebase");
     y += 10;
 
     drawSection("XY Mode");
     drawKey("F", "Toggle filter");
+    drawKey("O", "Cycle filter oversampling");
     drawKey("W", "Toggle square mode");
     y += 15;
 
@@ -218,7 +276,82 @@ private:
   visage::Animation<float> fade_animation_;
 };
 
-// Vintage control panel background
+// Instrumentation HUD: live Profiler numbers over the scope (F1 toggles it,
+// Shift+F1 writes faveworm_profile.csv/.json)
+class ProfilerOverlay : public visage::Frame {
+public:
+  explicit ProfilerOverlay(const Profiler &profiler) : profiler_(profiler) {
+    setIgnoresMouseEvents(true, true);
+  }
+
+  void draw(visage::Canvas &canvas) override {
+    if (!visible_)
+      return;
+
+    const float w = static_cast<float>(width());
+    const float h = static_cast<float>(height());
+    canvas.setColor(visage::Color(0.7f, 0.0f, 0.0f, 0.0f));
+    canvas.fill(0, 0, w, h);
+
+    visage::Font font(12, resources::fonts::DroidSansMono_ttf, dpiScale());
+    const float line_h = 16;
+    float y = 8;
+    char line[128];
+
+    auto drawLine = [&](float r, float g, float b) {
+      canvas.setColor(visage::Color(1.0f, r, g, b));
+      canvas.text(line, font, visage::Font::kTopLeft, 10, y, w - 20, line_h);
+      y += line_h;
+    };
+    auto stats = [&](const char *label, Profiler::Metric m, double scale) {
+      const Histogram &hist = profiler_.metric(m);
+      std::snprintf(line, sizeof(line), "%-10s %8.1f %8.1f %8.1f %s", label,
+                    hist.mean() * scale, hist.percentile(0.99) * scale,
+                    hist.max() * scale, Profiler::unit(m));
+      drawLine(0.8f, 0.9f, 0.95f);
+    };
+
+    std::snprintf(line, sizeof(line), "%-10s %8s %8s %8s", "", "mean", "p99",
+                  "max");
+    drawLine(0.5f, 0.9f, 0.8f);
+
+    stats("callback", Profiler::kAudioCallback, 1.0);
+    stats("load", Profiler::kAudioLoad, 1.0);
+    const uint64_t xruns = profiler_.totalXruns();
+    std::snprintf(line, sizeof(line), "%-10s %8.0f us period, %llu xruns",
+                  "buffer", profiler_.bufferPeriodUs(),
+                  static_cast<unsigned long long>(xruns));
+    if (xruns)
+      drawLine(1.0f, 0.4f, 0.3f);
+    else
+      drawLine(0.8f, 0.9f, 0.95f);
+
+    stats("interval", Profiler::kFrameInterval, 1.0);
+    stats("frame cpu", Profiler::kFrameCpu, 1.0);
+    stats("splat gen", Profiler::kSplatGen, 1.0);
+    stats("splat draw", Profiler::kSplatDraw, 1.0);
+
+    const Histogram &splats = profiler_.metric(Profiler::kSplats);
+    std::snprintf(line, sizeof(line), "%-10s %8.0f / %d per frame", "splats",
+                  splats.last(), profiler_.splatBudget());
+    drawLine(0.8f, 0.9f, 0.95f);
+    stats("quality", Profiler::kQuality, 1.0);
+
+    redraw();
+  }
+
+  void toggle() {
+    visible_ = !visible_;
+    redraw();
+  }
+
+  bool isVisible() const { return visible_; }
+
+private:
+  const Profiler &profiler_;
+  bool visible_ = false;
+};
+
 // Vintage control panel background
 class ControlPanel : public visage::ScrollableFrame {
 public:
@@ -281,8 +414,45 @@ private:
   std::string title_;
 };
 
+// The threaded web build (FAVEWORM_WEB_THREADS: pthreads over a
+// SharedArrayBuffer) plays through an AudioWorklet and runs the lock and splat
+// workers as the desktop build does; the plain web build does neither
+#define FAVEWORM_WORKLET (VISAGE_EMSCRIPTEN && FAVEWORM_WEB_THREADS)
+#define FAVEWORM_THREADS (!VISAGE_EMSCRIPTEN || FAVEWORM_WEB_THREADS)
+
 #if VISAGE_EMSCRIPTEN
 #include <SDL2/SDL.h>
+#if FAVEWORM_WORKLET
+#include <emscripten.h>
+#include <emscripten/webaudio.h>
+
+// Feeds the microphone into the worklet node (or disconnects it). The source
+// hangs off the node so a later call can stop it; wanted guards against a
+// permission prompt that resolves after capture was switched off again.
+EM_JS(void, faveworm_connect_capture, (int context, int node, int enable), {
+  const ctx = emscriptenGetAudioObject(context);
+  const dst = emscriptenGetAudioObject(node);
+  dst.favewormWanted = !!enable;
+  if (dst.favewormSource) {
+    dst.favewormSource.disconnect();
+    dst.favewormSource.mediaStream.getTracks().forEach((t) => t.stop());
+    dst.favewormSource = null;
+  }
+  if (!enable)
+    return;
+  const audio = {echoCancellation : false, noiseSuppression : false,
+                 autoGainControl : false, latency : 0};
+  navigator.mediaDevices.getUserMedia({audio}).then((stream) => {
+    if (!dst.favewormWanted || dst.favewormSource) {
+      stream.getTracks().forEach((t) => t.stop());
+      return;
+    }
+    dst.favewormSource = ctx.createMediaStreamSource(stream);
+    dst.favewormSource.connect(dst);
+  }).catch((e) => console.error("faveworm: no audio input", e));
+});
+EM_JS_DEPS(faveworm_capture, "$emscriptenGetAudioObject");
+#endif
 #else
 #include <portaudio.h>
 
@@ -301,188 +471,21 @@ enum class DisplayMode {
   XY           // X-Y mode (Lissajous)
 };
 
-// Simple WAV file loader
-struct AudioData {
-  std::vector<float> left;
-  std::vector<float> right;
-  int sample_rate = 44100;
-  bool stereo = false;
-
-  bool load(const std::string &path) {
-    if (loadWavInternal(path))
-      return true;
-
-#if !VISAGE_EMSCRIPTEN && defined(__APPLE__)
-    // Try converting with afconvert
-    std::srand(std::time(nullptr));
-    std::string temp_path =
-        "/tmp/faveworm_temp_" + std::to_string(std::rand()) + ".wav";
-    std::string cmd =
-        "afconvert -f WAVE -d LEF32 \"" + path + "\" \"" + temp_path + "\"";
-    if (std::system(cmd.c_str()) == 0) {
-      bool success = loadWavInternal(temp_path);
-      std::remove(temp_path.c_str());
-      return success;
-    }
-#endif
-    return false;
-  }
-
-  bool loadWavInternal(const std::string &path) {
-    std::ifstream file(path, std::ios::binary);
-    if (!file)
-      return false;
-
-    char riff[4];
-    file.read(riff, 4);
-    if (std::string(riff, 4) != "RIFF")
-      return false;
-
-    uint32_t file_size;
-    file.read(reinterpret_cast<char *>(&file_size), 4);
-
-    char wave[4];
-    file.read(wave, 4);
-    if (std::string(wave, 4) != "WAVE")
-      return false;
-
-    uint16_t audio_format = 0, num_channels = 0, bits_per_sample = 0;
-    uint32_t byte_rate = 0, block_align = 0;
-
-    while (file) {
-      char chunk_id[4];
-      uint32_t chunk_size;
-      file.read(chunk_id, 4);
-      file.read(reinterpret_cast<char *>(&chunk_size), 4);
-
-      if (std::string(chunk_id, 4) == "fmt ") {
-        file.read(reinterpret_cast<char *>(&audio_format), 2);
-        file.read(reinterpret_cast<char *>(&num_channels), 2);
-        file.read(reinterpret_cast<char *>(&sample_rate), 4);
-        file.read(reinterpret_cast<char *>(&byte_rate), 4);
-        file.read(reinterpret_cast<char *>(&block_align), 2);
-        file.read(reinterpret_cast<char *>(&bits_per_sample), 2);
-        if (chunk_size > 16)
-          file.seekg(chunk_size - 16, std::ios::cur);
-      } else if (std::string(chunk_id, 4) == "data") {
-        stereo = (num_channels == 2);
-        int num_samples = chunk_size / (bits_per_sample / 8) / num_channels;
-        left.resize(num_samples);
-        if (stereo)
-          right.resize(num_samples);
-
-        for (int i = 0; i < num_samples; ++i) {
-          if (bits_per_sample == 16) {
-            int16_t sample;
-            file.read(reinterpret_cast<char *>(&sample), 2);
-            left[i] = sample / 32768.0f;
-            if (stereo) {
-              file.read(reinterpret_cast<char *>(&sample), 2);
-              right[i] = sample / 32768.0f;
-            }
-          } else if (bits_per_sample == 24) {
-            uint8_t bytes[3];
-            file.read(reinterpret_cast<char *>(bytes), 3);
-            int32_t sample =
-                (bytes[2] << 24) | (bytes[1] << 16) | (bytes[0] << 8);
-            left[i] = sample / 2147483648.0f;
-            if (stereo) {
-              file.read(reinterpret_cast<char *>(bytes), 3);
-              sample = (bytes[2] << 24) | (bytes[1] << 16) | (bytes[0] << 8);
-              right[i] = sample / 2147483648.0f;
-            }
-          } else if (bits_per_sample == 32) {
-            if (audio_format == 3) {
-              float sample;
-              file.read(reinterpret_cast<char *>(&sample), 4);
-              left[i] = sample;
-              if (stereo) {
-                file.read(reinterpret_cast<char *>(&sample), 4);
-                right[i] = sample;
-              }
-            } else {
-              int32_t sample;
-              file.read(reinterpret_cast<char *>(&sample), 4);
-              left[i] = sample / 2147483648.0f;
-              if (stereo) {
-                file.read(reinterpret_cast<char *>(&sample), 4);
-                right[i] = sample / 2147483648.0f;
-              }
-            }
-          }
-        }
-        break;
-      } else {
-        file.seekg(chunk_size, std::ios::cur);
-      }
-    }
-
-    if (!stereo && !left.empty()) {
-      right = left;
-      stereo = true;
-    }
-
-    return !left.empty();
-  }
-};
-
-// Ring buffer for visualization and trigger detection
-class RingBuffer {
-public:
-  static constexpr size_t kSize = 16384; // Must be power of 2
-
-  void write(float left, float right) {
-    size_t pos = write_pos_.load(std::memory_order_relaxed);
-    left_[pos & (kSize - 1)] = left;
-    right_[pos & (kSize - 1)] = right;
-    write_pos_.store(pos + 1, std::memory_order_release);
-  }
-
-  void read(std::vector<float> &left, std::vector<float> &right,
-            int num_samples, int offset = 0) {
-    size_t pos = write_pos_.load(std::memory_order_acquire);
-    left.resize(num_samples);
-    right.resize(num_samples);
-
-    size_t start = (pos >= static_cast<size_t>(num_samples + offset))
-                       ? pos - num_samples - offset
-                       : 0;
-    for (int i = 0; i < num_samples; ++i) {
-      size_t idx = (start + i) & (kSize - 1);
-      left[i] = left_[idx];
-      right[i] = right_[idx];
-    }
-  }
-
-  // Read a single sample at offset from current position (negative = past)
-  float readLeft(int offset) const {
-    size_t pos = write_pos_.load(std::memory_order_acquire);
-    return left_[(pos + offset) & (kSize - 1)];
-  }
-
-  float readRight(int offset) const {
-    size_t pos = write_pos_.load(std::memory_order_acquire);
-    return right_[(pos + offset) & (kSize - 1)];
-  }
-
-  float readLeftAt(size_t index) const { return left_[index & (kSize - 1)]; }
-  float readRightAt(size_t index) const { return right_[index & (kSize - 1)]; }
-
-  size_t writePos() const { return write_pos_.load(std::memory_order_acquire); }
-
-private:
-  float left_[kSize] = {};
-  float right_[kSize] = {};
-  std::atomic<size_t> write_pos_{0};
-};
-
 // Audio player with trigger detection
 class AudioPlayer {
 public:
-  static constexpr int kSweepSamples = 1024; // Samples per sweep
-  static constexpr int kDeadSamples = 256;   // Dead time after trigger
-  static constexpr int kEvalSamples =
-      512; // Evaluation window for waveform locking
+  static constexpr int kSweepSamples = ScopeChain::kSweepSamples;
+  static constexpr int kDeadSamples = 256; // Dead time after trigger
+  static constexpr int kEvalSamples = ScopeChain::kEvalSamples;
+  static constexpr int kControlBlock =
+      ScopeChain::kMaxFrames; // Frames per parameter update
+  static constexpr int kMaxTraces = 1 + ScopeChannel::kMaxExtraTraces;
+  static constexpr int kPrefetchSeconds = 2; // File read-ahead window
+  static constexpr int kOutputBufferFrames = 512;
+  static constexpr int kInputBufferFrames = 128; // ~3 ms at 44.1 kHz
+  static constexpr int kWebBufferFrames = 4096;  // Larger for stability on web
+  static constexpr int kWebInputBufferFrames = 1024; // SDL capture, ~23 ms
+  static constexpr int kWorkletQuantum = 128; // Web Audio render quantum
 
   ~AudioPlayer() {
 #if !VISAGE_EMSCRIPTEN
@@ -490,12 +493,15 @@ public:
     if (is_playing_ && stream_) {
       shutting_down_ = true;
       // Wait for gain to ramp down (max ~50ms at 44.1kHz)
-      for (int i = 0; i < 100 && current_gain_ > 0.001f; ++i) {
+      for (int i = 0; i < 100 && chain_.gain() > 0.001f; ++i) {
         Pa_Sleep(1);
       }
     }
 #endif
     stop();
+#if FAVEWORM_THREADS
+    stopLockWorker();
+#endif
   }
 
   AudioPlayer() {
@@ -508,32 +514,46 @@ public:
     stereo_router_.setResonance(1.0);
     stereo_router_.setSplitMode(StereoFilterRouter::SplitMode::LpHp);
 #if VISAGE_EMSCRIPTEN
-    volume_ = 0.0f;
-#else
-    volume_ = kDefaultVolume;
+    params_.reset(kParamVolume, 0.0f);
 #endif
     paused_ = false;
-    current_gain_ = 0.0f;
+#if FAVEWORM_THREADS
+    startLockWorker();
+#endif
   }
 
   bool load(const std::string &path) {
     if (!audio_data_.load(path))
       return false;
     play_position_ = 0;
+    resampler_.reset();
+    buildFileLevels();
     return true;
   }
 
   void setTestGenerator(TestSignalGenerator *gen) { test_generator_ = gen; }
 
+  // Record callback timing and xruns into profiler (set before play())
+  void setProfiler(Profiler *profiler) { profiler_ = profiler; }
+
+  // Share of the last buffer period the callback took (1 = at the deadline)
+  float callbackLoad() const {
+    return callback_load_.load(std::memory_order_relaxed);
+  }
+
   void play() {
 #if !VISAGE_EMSCRIPTEN
     if (is_playing_)
       return;
 #endif
 
-    if (audio_data_.left.empty() && !test_generator_)
+    if (audio_data_.empty() && !test_generator_ && !live_input_)
       return;
 
+#if FAVEWORM_WORKLET
+    playWorklet();
+    return;
+#endif
 #if VISAGE_EMSCRIPTEN
     if (is_playing_) {
       if (device_ != 0)
@@ -548,19 +568,24 @@ public:
     }
     SDL_AudioSpec want, have;
     SDL_memset(&want, 0, sizeof(want));
-    want.freq = audio_data_.left.empty() ? 44100 : audio_data_.sample_rate;
+    want.freq = audio_data_.empty() ? 44100 : audio_data_.sampleRate();
     want.format = AUDIO_F32;
     want.channels = 2;
-    want.samples = 4096; // Larger buffer for stability on web
-    want.callback = sdlCallback;
+    want.samples = static_cast<Uint16>(bufferFrames());
+    want.callback = live_input_ ? sdlCaptureCallback : sdlCallback;
     want.userdata = this;
 
-    device_ = SDL_OpenAudioDevice(nullptr, 0, &want, &have,
+    // Live input captures through getUserMedia and opens no output, so the
+    // program audio isn't echoed back
+    capturing_ = live_input_;
+    device_ = SDL_OpenAudioDevice(nullptr, live_input_ ? 1 : 0, &want, &have,
                                   SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
     if (device_ == 0)
       return;
 
-    sample_rate_ = have.freq;
+    // The browser may insist on its own rate
+    configureRate(have.freq);
+    input_channels_ = have.channels;
 
     SDL_PauseAudioDevice(device_, 0);
     is_playing_ = true;
@@ -569,6 +594,11 @@ public:
     if (init_err != paNoError)
       return;
 
+    if (live_input_) {
+      openInputStream();
+      return;
+    }
+
     PaStreamParameters outputParameters;
     outputParameters.device = getOutputDevice(use_speaker_);
     if (outputParameters.device == paNoDevice) {
@@ -587,10 +617,48 @@ public:
     outputParameters.suggestedLatency = info->defaultLowOutputLatency;
     outputParameters.hostApiSpecificStreamInfo = nullptr;
 
-    double sr = audio_data_.left.empty() ? 44100.0 : audio_data_.sample_rate;
-    sample_rate_ = sr;
+    // Play at the file's own rate where the device supports it, otherwise
+    // at the device rate with our resampler in between
+    double sr = audio_data_.empty() ? 44100.0 : audio_data_.sampleRate();
+    if (Pa_IsFormatSupported(nullptr, &outputParameters, sr) !=
+        paFormatIsSupported)
+      sr = info->defaultSampleRate;
+    configureRate(sr);
+    capturing_ = false;
 
-    PaError err = Pa_OpenStream(&stream_, nullptr, &outputParameters, sr, 512,
+    startStream(nullptr, &outputParameters, sr);
+#endif
+  }
+
+#if !VISAGE_EMSCRIPTEN
+  // Input-only stream: captured audio goes through the filter/morpher path
+  // into the ring buffer and nothing is played back
+  void openInputStream() {
+    PaStreamParameters inputParameters;
+    inputParameters.device =
+        input_device_ >= 0 ? input_device_ : Pa_GetDefaultInputDevice();
+    if (inputParameters.device == paNoDevice)
+      return;
+
+    const PaDeviceInfo *info = Pa_GetDeviceInfo(inputParameters.device);
+    if (!info || info->maxInputChannels < 1)
+      return;
+
+    input_channels_ = std::min(2, info->maxInputChannels);
+    inputParameters.channelCount = input_channels_;
+    inputParameters.sampleFormat = paFloat32;
+    inputParameters.suggestedLatency = info->defaultLowInputLatency;
+    inputParameters.hostApiSpecificStreamInfo = nullptr;
+
+    configureRate(info->defaultSampleRate);
+    capturing_ = true;
+
+    startStream(&inputParameters, nullptr, info->defaultSampleRate);
+  }
+
+  void startStream(const PaStreamParameters *input,
+                   const PaStreamParameters *output, double sr) {
+    PaError err = Pa_OpenStream(&stream_, input, output, sr, bufferFrames(),
                                 paClipOff, paCallback, this);
     if (err != paNoError)
       return;
@@ -603,14 +671,19 @@ public:
     }
 
     is_playing_ = true;
-#endif
   }
+#endif
 
   void stop() {
     if (!is_playing_)
       return;
 
 #if VISAGE_EMSCRIPTEN
+#if FAVEWORM_WORKLET
+    stopWorklet();
+    if (capturing_ && worklet_node_ != 0)
+      faveworm_connect_capture(audio_context_, worklet_node_, false);
+#endif
     if (device_ != 0) {
       SDL_CloseAudioDevice(device_);
       device_ = 0;
@@ -631,19 +704,102 @@ public:
 
   bool isPaused() const { return paused_; }
   void setPaused(bool p) {
+    if (!p)
+      deferred_step_ = 0;
     paused_ = p;
     if (test_generator_)
       test_generator_->setPaused(p);
   }
 
-  void getCurrentSamples(std::vector<float> &left, std::vector<float> &right,
-                         int num_samples) {
-    ring_buffer_.read(left, right, num_samples);
+  // Latch the stream position this display frame shows (UI thread). The
+  // newest callback is revealed gradually over its own duration, so the view
+  // advances at the sample rate instead of jumping a device buffer at a time.
+  void beginFrame() {
+    params_.flush(); // Anything a full queue turned away
+    if (offline_)
+      return; // latchFrame() sets the position
+    if (deferred_step_ != 0) {
+      const int samples = deferred_step_;
+      deferred_step_ = 0;
+      step(samples);
+    }
+    ScopeChannel::Stamp stamp = channel_.stamp();
+    double elapsed = (ScopeChannel::now() - stamp.time) * sample_rate_;
+    size_t shown = static_cast<size_t>(
+        std::clamp(elapsed, 0.0, static_cast<double>(stamp.frames)));
+    size_t end = stamp.end - std::min(stamp.frames, stamp.end) + shown;
+    if (end < frame_end_ && frame_end_ <= stamp.end)
+      end = frame_end_;
+    frame_end_ = end;
+    frame_trigger_ = stamp.trigger;
+  }
+
+  // Multichannel files show one trace per channel pair: trace 0 is the main
+  // (filtered, triggered, heard) pair, the others are drawn raw beside it.
+  // Shown: the first n traces the file has channels for.
+  void setNumTraces(int n) { num_traces_ = std::clamp(n, 1, kMaxTraces); }
+  int numTraces() const {
+    if (capturing_)
+      return 1;
+    return std::min(num_traces_.load(std::memory_order_relaxed),
+                    1 + channel_.extraTraces());
   }
 
-  // Step forward or backward in time (only used when frozen)
+  // File channels (0-based) trace t shows on X and Y
+  void setTraceChannels(int t, int x_channel, int y_channel) {
+    if (t < 0 || t >= kMaxTraces)
+      return;
+    x_channel = std::clamp(x_channel, 0, 255);
+    y_channel = std::clamp(y_channel, 0, 255);
+    trace_channels_[t] = x_channel | y_channel << 8;
+  }
+  int traceChannel(int t, bool y) const {
+    if (t < 0 || t >= kMaxTraces)
+      return 0;
+    const int packed = trace_channels_[t].load(std::memory_order_relaxed);
+    return y ? packed >> 8 : packed & 0xff;
+  }
+
+  // Copy the num_samples ending offset samples before the frame position
+  void getCurrentSamples(float *left, float *right, int num_samples,
+                         int offset = 0) {
+    size_t end = frame_end_ - std::min<size_t>(offset, frame_end_);
+    size_t start = end - std::min<size_t>(num_samples, end);
+    window_start_ = start;
+    if (channel_.read(start, left, right, num_samples))
+      return;
+    // Lapped by the writer: the window is gone
+    std::fill(left, left + num_samples, 0.0f);
+    std::fill(right, right + num_samples, 0.0f);
+  }
+
+  // Step forward or backward in time (only used when frozen). The channel
+  // has one producer at a time: while a stream runs, the step waits until
+  // its callback has faded out and handed the channel over (see
+  // claimScope), and until then is kept for beginFrame() to retry.
   void step(int samples) {
-    if (audio_data_.left.empty()) {
+    // Live input has no timeline to move through
+    if (capturing_)
+      return;
+
+    int owner = kOwnerFrozen;
+    if (is_playing_ && !scope_owner_.compare_exchange_strong(
+                           owner, kOwnerStep, std::memory_order_acquire,
+                           std::memory_order_relaxed)) {
+      deferred_step_ += samples;
+      return;
+    }
+    stepFrozen(samples);
+    if (is_playing_)
+      scope_owner_.store(kOwnerFrozen, std::memory_order_release);
+  }
+
+  // A step() is waiting for the audio thread to freeze
+  bool stepPending() const { return deferred_step_ != 0; }
+
+private:
+  void stepFrozen(int samples) {
+    if (audio_data_.empty()) {
       if (test_generator_) {
         // Shift phase to new position - history window
         test_generator_->advance(samples - kSweepSamples);
@@ -676,68 +832,286 @@ public:
             }
           }
 
-          ring_buffer_.write(scope_l, scope_r);
+          channel_.write(scope_l, scope_r);
         }
+        publishStep();
       }
       return;
     }
 
-    size_t total = audio_data_.left.size();
+    // Steps count stream frames, like the scope; the file moves at its rate
+    size_t total = audio_data_.numFrames();
+    float l[kSweepSamples], r[kSweepSamples];
     if (samples > 0) {
-      for (int i = 0; i < samples; ++i) {
-        size_t idx = play_position_ % total;
-        float l = audio_data_.left[idx];
-        float r =
-            audio_data_.stereo ? audio_data_.right[idx] : audio_data_.left[idx];
-        ring_buffer_.write(l, r);
-        play_position_++;
+      for (int done = 0; done < samples; done += kSweepSamples) {
+        int count = std::min(kSweepSamples, samples - done);
+        readStream(l, r, count);
+        channel_.write(l, r, count);
+        channel_.commit();
       }
     } else {
-      int abs_samples = -samples;
-      play_position_ = (play_position_ + total - abs_samples) % total;
+      // Back from the frame now shown, and a sweep further to show up to it
+      const double to_file = resampling_ ? resampler_.getRatio() : 1.0;
+      const size_t lag =
+          resampling_ ? std::max(0, resampler_.getLookahead()) : 0;
+      const size_t back = lag + static_cast<size_t>(std::llround(
+                                    (kSweepSamples - samples) * to_file));
+      seekFile((play_position_ + total - back % total) % total);
 
       // Update ring buffer so the visualization shows the new position
-      int update_samples = kSweepSamples;
-      for (int i = 0; i < update_samples; ++i) {
-        size_t idx = (play_position_ - update_samples + i + total) % total;
-        float l = audio_data_.left[idx];
-        float r =
-            audio_data_.stereo ? audio_data_.right[idx] : audio_data_.left[idx];
-        ring_buffer_.write(l, r);
-      }
+      readStream(l, r, kSweepSamples);
+      channel_.write(l, r, kSweepSamples);
     }
+    publishStep();
   }
 
-  // Read triggered samples from the audio thread's latest discovered trigger
-  // point
-  bool getTriggeredSamples(std::vector<float> &out, int num_samples) {
-    size_t write_pos = ring_buffer_.writePos();
-    size_t trigger_pos = latest_trigger_pos_.load(std::memory_order_acquire);
+  // The next count stream frames of the file's main pair, resampled as the
+  // callback reads them (frozen)
+  void readStream(float *l, float *r, int count) {
+    const size_t total = audio_data_.numFrames();
+    auto read = [&](float *dst_l, float *dst_r, int n) {
+      audio_data_.read(play_position_, dst_l, dst_r, n);
+      play_position_ = (play_position_ + n) % total;
+    };
+    if (resampling_)
+      resampler_.process(l, r, count, read);
+    else
+      read(l, r, count);
+  }
 
-    // If no trigger yet, or it's too old, just free run from the end
-    if (trigger_pos == 0 || (write_pos - trigger_pos) > RingBuffer::kSize / 2) {
-      out.resize(num_samples);
-      for (int i = 0; i < num_samples; ++i)
-        out[i] = ring_buffer_.readLeft(-num_samples + i);
-      return false;
+  // Continue the file from position (file frames). The resampler restarts
+  // there with its history primed from the file, so no samples from before
+  // the seek leak past it.
+  void seekFile(size_t position) {
+    const size_t total = audio_data_.numFrames();
+    if (!resampling_) {
+      play_position_ = position % total;
+      return;
+    }
+    // The first output after a reset is centred a window short of the
+    // source position: start that much early and drop what precedes it
+    const int latency = resampler_.getLatency();
+    const size_t taps = 2 * static_cast<size_t>(latency);
+    play_position_ = (position + total - taps % total) % total;
+    resampler_.reset();
+    int prime = static_cast<int>(
+        std::lround((taps + latency - 1) / resampler_.getRatio()));
+    float l[kSweepSamples], r[kSweepSamples];
+    while (prime > 0) {
+      const int n = std::min(prime, kSweepSamples);
+      readStream(l, r, n);
+      prime -= n;
     }
+  }
 
-    out.resize(num_samples);
-    for (int i = 0; i < num_samples; ++i) {
-      // Use the stored trigger position as the start of our sweep
-      size_t idx = (trigger_pos + i) & (RingBuffer::kSize - 1);
-      out[i] = ring_buffer_.readLeftAt(idx);
+public:
+  // Read the sweep starting at the current trigger (see triggerStart), or
+  // free run if there is none. A sweep offset samples before the frame
+  // position (trail frames) triggers there instead (see pastTriggerStart).
+  // out must hold num_samples floats
+  bool getTriggeredSamples(float *out, int num_samples, int offset = 0) {
+    size_t trigger_pos = offset == 0 ? triggerStart(num_samples)
+                                     : pastTriggerStart(num_samples, offset,
+                                                        out);
+    window_start_ = trigger_pos;
+    if (trigger_pos && channel_.read(trigger_pos, out, nullptr, num_samples))
+      return true;
+
+    size_t end = frame_end_ - std::min<size_t>(offset, frame_end_);
+    size_t start = end - std::min<size_t>(num_samples, end);
+    window_start_ = start;
+    if (!channel_.read(start, out, nullptr, num_samples))
+      std::fill(out, out + num_samples, 0.0f);
+    return false;
+  }
+
+  // Trace t (1 or more) over the window the last getCurrentSamples or
+  // getTriggeredSamples call read, so every trace lines up with the main one
+  void getTraceSamples(int t, float *x, float *y, int num_samples) {
+    if (!channel_.readTrace(t - 1, window_start_, x, y, num_samples)) {
+      std::fill(x, x + num_samples, 0.0f);
+      std::fill(y, y + num_samples, 0.0f);
     }
+  }
 
-    return true;
+  // Longest window the scope history can show
+  size_t historyFrames() const {
+    return channel_.capacity() - 2 * ScopeChannel::kMaxUnpublished;
+  }
+
+  // True if len samples in columns needs the level pyramid rather than
+  // individual samples
+  bool needsLevels(size_t len, int columns) const {
+    return channel_.levelSpan(len, columns) != 0;
+  }
+
+  // Reduce len samples of the X channel to columns min/max buckets: from the
+  // trigger if triggered and there is one, else ending offset samples before
+  // the frame position. Windows longer than the scope history come from the
+  // loaded file's own pyramid.
+  // out must hold columns buckets
+  bool getLevels(size_t len, int columns, bool triggered, int offset,
+                 LevelPyramid::Bucket *out) {
+    if (len > historyFrames() && !capturing_ && hasAudio()) {
+      if (file_levels_.empty()) {
+        std::fill(out, out + columns, LevelPyramid::Bucket());
+        return true; // Until the first prefetch() sizes them
+      }
+      // Map the frame position back into the file, in file frames
+      const double to_file = audio_data_.sampleRate() / sample_rate_;
+      size_t total = audio_data_.numFrames();
+      size_t behind = static_cast<size_t>(
+          (channel_.writePos() - frame_end_ + offset) * to_file) % total;
+      size_t end = (play_position_ + total - behind) % total;
+      size_t start =
+          end - std::min(static_cast<size_t>(len * to_file), end);
+      file_levels_.query(start, end - start, columns, file_levels_end_, out);
+      return true;
+    }
+
+    len = std::min(len, historyFrames());
+    size_t start = triggered ? triggerStart(len) : 0;
+    if (start == 0) {
+      // Free run on whole buckets so the envelope doesn't shimmer
+      size_t span = std::max<size_t>(1, channel_.levelSpan(len, columns));
+      size_t end = frame_end_ - std::min<size_t>(offset, frame_end_);
+      end -= end % span;
+      start = end - std::min(len, end);
+    }
+    return channel_.readLevels(start, len, columns, out);
   }
 
   void setTriggerThreshold(float v) { trigger_threshold_.store(v); }
   void setTriggerRising(bool v) { trigger_rising_.store(v); }
-  void setTriggerLock(bool v) { trigger_lock_.store(v); }
+  void setTriggerLock(bool v) {
+    if (v && !trigger_lock_.load())
+      lock_reset_ = true;
+    trigger_lock_.store(v);
+#if FAVEWORM_THREADS
+    if (v)
+      startLockWorker();
+    else
+      stopLockWorker();
+#endif
+  }
   void startShutdown() { shutting_down_ = true; }
-  bool hasAudio() const { return !audio_data_.left.empty(); }
-  int sampleRate() const { return audio_data_.sample_rate; }
+  bool hasAudio() const { return !audio_data_.empty(); }
+  double duration() const {
+    return static_cast<double>(audio_data_.numFrames()) /
+           audio_data_.sampleRate();
+  }
+
+  // Offline rendering: no device; the caller pulls the file through the DSP
+  // chain frame by frame, faster than real time. Positions are recorded per
+  // video frame so the render thread may lag the DSP thread deterministically.
+  struct OfflineFrame {
+    size_t end = 0;
+    size_t trigger = 0;
+    size_t locked = 0;
+  };
+
+  bool startOffline() {
+    if (audio_data_.empty())
+      return false;
+    stop();
+    offline_ = true;
+    configureRate(audio_data_.sampleRate());
+    play_position_ = 0;
+    paused_ = false;
+    is_playing_ = true;
+    // Not interactive: every video frame gets the whole file's levels
+    extendFileLevels(audio_data_.numFrames());
+    return true;
+  }
+
+  // Process the next num_frames samples and lock on them (DSP thread)
+  OfflineFrame renderOffline(int num_frames) {
+    process(nullptr, nullptr, num_frames);
+    updateLock();
+    return {channel_.head(), chain_.triggerPos(),
+            locked_pos_.load(std::memory_order_relaxed)};
+  }
+
+  // Show the stream as it was at the end of an offline frame (render thread)
+  void latchFrame(const OfflineFrame &frame) {
+    frame_end_ = frame.end;
+    frame_trigger_ = frame.trigger;
+    frame_locked_ = frame.locked;
+  }
+  // Stream (processing) rate; the file may differ when resampling
+  int sampleRate() const { return static_cast<int>(sample_rate_); }
+
+  // Ask the OS to page in the file ahead of the play position (UI thread)
+  void prefetch() {
+    audio_data_.prefetch(play_position_,
+                         kPrefetchSeconds * audio_data_.sampleRate());
+    extendFileLevels(kLevelFramesPerDraw);
+  }
+
+  // Scope a capture device (line-in, loopback from a DAW) instead of the
+  // loaded file or test generator
+  void setLiveInput(bool enabled) {
+    if (live_input_ == enabled)
+      return;
+    live_input_ = enabled;
+    restart();
+  }
+  bool liveInput() const { return live_input_; }
+
+  // PortAudio device index; -1 selects the default input
+  void setInputDevice(int index) {
+    if (input_device_ == index)
+      return;
+    input_device_ = index;
+    if (live_input_)
+      restart();
+  }
+  int inputDevice() const { return input_device_; }
+
+  // Step to the next device that has input channels (desktop only)
+  void cycleInputDevice() {
+#if !VISAGE_EMSCRIPTEN
+    int num_devices = Pa_GetDeviceCount();
+    for (int i = 1; i <= num_devices; ++i) {
+      int index = (input_device_ + i) % num_devices;
+      const PaDeviceInfo *info = Pa_GetDeviceInfo(index);
+      if (info && info->maxInputChannels > 0) {
+        setInputDevice(index);
+        return;
+      }
+    }
+#endif
+  }
+
+  const char *inputDeviceName() const {
+#if !VISAGE_EMSCRIPTEN
+    int index = input_device_ >= 0 ? input_device_ : Pa_GetDefaultInputDevice();
+    if (const PaDeviceInfo *info = Pa_GetDeviceInfo(index))
+      return info->name;
+#endif
+    return "Default input";
+  }
+
+  // Device buffer size in frames; 0 picks a default for the current mode.
+  // Live input defaults small so capture-to-screen stays under a frame.
+  void setBufferFrames(int frames) {
+    frames = frames > 0 ? std::clamp(frames, 32, 8192) : 0;
+    if (buffer_frames_ == frames)
+      return;
+    buffer_frames_ = frames;
+    restart();
+  }
+  int bufferFrames() const {
+    if (buffer_frames_ > 0)
+      return buffer_frames_;
+#if FAVEWORM_WORKLET
+    return kWorkletQuantum;
+#elif VISAGE_EMSCRIPTEN
+    return live_input_ ? kWebInputBufferFrames : kWebBufferFrames;
+#else
+    return live_input_ ? kInputBufferFrames : kOutputBufferFrames;
+#endif
+  }
 
   void setSpeakerOutput(bool use_speaker) {
     if (use_speaker_ == use_speaker)
@@ -748,6 +1122,10 @@ public:
     // device. To avoid clicks, we should technically ramp down first, but for
     // now we'll just allow the hardware switch to be a bit abrupt, or the user
     // can mute first.
+    restart();
+  }
+
+  void restart() {
     if (is_playing_) {
       stop();
       play();
@@ -789,8 +1167,13 @@ public:
 
   bool useSpeaker() const { return use_speaker_; }
 
-  void setVolume(float v) { volume_ = std::clamp(v, 0.0f, 1.0f); }
-  float volume() const { return volume_; }
+  void setVolume(float v) { params_.set(kParamVolume, v); }
+  float volume() const { return params_.get(kParamVolume); }
+
+  // Queue a change for the audio thread, which glides to it over the
+  // parameter's ramp (UI thread)
+  void setParam(AudioParam id, float value) { params_.set(id, value); }
+  float param(AudioParam id) const { return params_.get(id); }
 
 private:
 #if VISAGE_EMSCRIPTEN
@@ -798,192 +1181,650 @@ private:
     auto *player = static_cast<AudioPlayer *>(userData);
     float *out = reinterpret_cast<float *>(stream);
     int num_samples = len / (2 * sizeof(float));
-    player->process(out, num_samples);
+    player->process(nullptr, out, num_samples);
+  }
+
+  static void sdlCaptureCallback(void *userData, Uint8 *stream, int len) {
+    auto *player = static_cast<AudioPlayer *>(userData);
+    const float *in = reinterpret_cast<const float *>(stream);
+    int num_samples = len / (player->input_channels_ * sizeof(float));
+    player->process(in, nullptr, num_samples);
+  }
+
+#if FAVEWORM_WORKLET
+  // Output and live input through an AudioWorklet
+  // process() runs on the audio rendering thread one render quantum at a
+  // time. The module's memory is a SharedArrayBuffer, so the scope ring it
+  // writes is the one the render loop reads, as with a desktop callback. The
+  // context is created on the first play() at the rate wanted then (the
+  // resampler covers later files) and starts suspended; play() from a user
+  // gesture resumes it. Live input connects the microphone to the node's
+  // input and plays silence, so capture also runs at 128 frames (~3 ms)
+  // rather than SDL's 1024-frame ScriptProcessor buffer; the browser's own
+  // input path comes on top.
+  void playWorklet() {
+    if (audio_context_ == 0) {
+      worklet_rate_ = audio_data_.empty() ? 44100 : audio_data_.sampleRate();
+      EmscriptenWebAudioCreateAttributes attributes = {};
+      attributes.latencyHint = "interactive";
+      attributes.sampleRate = static_cast<uint32_t>(worklet_rate_);
+      audio_context_ = emscripten_create_audio_context(&attributes);
+      if (audio_context_ == 0)
+        return;
+      emscripten_start_wasm_audio_worklet_thread_async(
+          audio_context_, worklet_stack_, kWorkletStackSize,
+          workletThreadStarted, this);
+    }
+    if (!is_playing_) {
+      configureRate(worklet_rate_);
+      capturing_ = live_input_;
+      input_channels_ = 2; // workletCallback interleaves to stereo
+      if (worklet_node_ != 0)
+        faveworm_connect_capture(audio_context_, worklet_node_, capturing_);
+      worklet_state_.store(kWorkletRunning, std::memory_order_release);
+      is_playing_ = true;
+    }
+    emscripten_resume_audio_context_sync(audio_context_);
+  }
+
+  // Waits out a quantum in flight, so the rate can be reconfigured after
+  void stopWorklet() {
+    int expected = kWorkletRunning;
+    while (!worklet_state_.compare_exchange_weak(expected, kWorkletStopped,
+                                                 std::memory_order_acq_rel)) {
+      if (expected == kWorkletStopped)
+        return;
+      expected = kWorkletRunning;
+    }
+  }
+
+  static void workletThreadStarted(EMSCRIPTEN_WEBAUDIO_T context,
+                                   EM_BOOL success, void *user_data) {
+    if (!success)
+      return;
+    WebAudioWorkletProcessorCreateOptions options = {};
+    options.name = "faveworm";
+    emscripten_create_wasm_audio_worklet_processor_async(
+        context, &options, workletProcessorCreated, user_data);
+  }
+
+  static void workletProcessorCreated(EMSCRIPTEN_WEBAUDIO_T context,
+                                      EM_BOOL success, void *user_data) {
+    if (!success)
+      return;
+    auto *player = static_cast<AudioPlayer *>(user_data);
+    int output_channels[1] = {2};
+    EmscriptenAudioWorkletNodeCreateOptions options = {};
+    options.numberOfInputs = 1;
+    options.numberOfOutputs = 1;
+    options.outputChannelCounts = output_channels;
+    player->worklet_node_ = emscripten_create_wasm_audio_worklet_node(
+        context, "faveworm", &options, workletCallback, user_data);
+    emscripten_audio_node_connect(player->worklet_node_, context, 0, 0);
+    if (player->capturing_)
+      faveworm_connect_capture(context, player->worklet_node_, true);
+  }
+
+  static EM_BOOL workletCallback(int num_inputs,
+                                 const AudioSampleFrame *inputs, int,
+                                 AudioSampleFrame *outputs, int,
+                                 const AudioParamFrame *, void *user_data) {
+    auto *player = static_cast<AudioPlayer *>(user_data);
+    float frames[2 * kWorkletQuantum];
+    std::fill(std::begin(frames), std::end(frames), 0.0f);
+    int expected = kWorkletRunning;
+    if (player->worklet_state_.compare_exchange_strong(
+            expected, kWorkletBusy, std::memory_order_acquire)) {
+      if (player->capturing_) {
+        // Planar, and no channels until the microphone is connected
+        float in[2 * kWorkletQuantum];
+        const int channels = num_inputs > 0 ? inputs[0].numberOfChannels : 0;
+        for (int c = 0; c < 2 && channels > 0; ++c) {
+          const float *src =
+              inputs[0].data + std::min(c, channels - 1) * kWorkletQuantum;
+          for (int i = 0; i < kWorkletQuantum; ++i)
+            in[2 * i + c] = src[i];
+        }
+        player->process(channels > 0 ? in : nullptr, nullptr, kWorkletQuantum);
+      } else {
+        player->process(nullptr, frames, kWorkletQuantum);
+      }
+      player->worklet_state_.store(kWorkletRunning, std::memory_order_release);
+    }
+
+    // Web Audio buffers are planar
+    AudioSampleFrame &out = outputs[0];
+    for (int c = 0; c < out.numberOfChannels; ++c) {
+      float *dst = out.data + c * kWorkletQuantum;
+      for (int i = 0; i < kWorkletQuantum; ++i)
+        dst[i] = frames[2 * i + std::min(c, 1)];
+    }
+    return EM_TRUE;
   }
+#endif
 #else
   static int paCallback(const void *inputBuffer, void *outputBuffer,
                         unsigned long framesPerBuffer,
                         const PaStreamCallbackTimeInfo *timeInfo,
                         PaStreamCallbackFlags statusFlags, void *userData) {
     auto *player = static_cast<AudioPlayer *>(userData);
-    float *out = static_cast<float *>(outputBuffer);
-    player->process(out, framesPerBuffer);
+    if (statusFlags && player->profiler_) {
+      Profiler *profiler = player->profiler_;
+      if (statusFlags & paInputUnderflow)
+        profiler->countXrun(Profiler::kInputUnderflow);
+      if (statusFlags & paInputOverflow)
+        profiler->countXrun(Profiler::kInputOverflow);
+      if (statusFlags & paOutputUnderflow)
+        profiler->countXrun(Profiler::kOutputUnderflow);
+      if (statusFlags & paOutputOverflow)
+        profiler->countXrun(Profiler::kOutputOverflow);
+    }
+    player->process(static_cast<const float *>(inputBuffer),
+                    static_cast<float *>(outputBuffer), framesPerBuffer);
     return paContinue;
   }
 #endif
 
-  void process(float *out, unsigned long framesPerBuffer) {
-    size_t total = audio_data_.left.size();
+  // Split the device buffer into control blocks. Shared parameters, the LFO
+  // and filter coefficients are updated once per block; the per-sample loop
+  // only runs the SVF and morpher math.
+  // in is the interleaved capture buffer (live input only); out is null for
+  // input-only streams.
+  void process(const float *in, float *out, unsigned long framesPerBuffer) {
+    const double start_us = Profiler::nowUs();
+    if (claimScope()) {
+      size_t head = channel_.head();
+      unsigned long done = 0;
+      while (done < framesPerBuffer) {
+        int n = static_cast<int>(
+            std::min<unsigned long>(kControlBlock, framesPerBuffer - done));
+        processBlock(in ? in + done * input_channels_ : nullptr,
+                     out ? out + done * 2 : nullptr, n);
+        done += n;
+      }
+      // Stamp the callback for frame alignment (nothing new while paused)
+      if (channel_.head() != head) {
+        channel_.publish(framesPerBuffer, chain_.triggerPos(),
+                         ScopeChannel::now());
+#if FAVEWORM_THREADS
+        wakeLockWorker();
+#endif
+      }
+    } else if (out) {
+      std::fill(out, out + framesPerBuffer * 2, 0.0f);
+    }
+
+    const double us = Profiler::nowUs() - start_us;
+    const double period_us = 1e6 * framesPerBuffer / sample_rate_;
+    callback_load_.store(static_cast<float>(us / period_us),
+                         std::memory_order_relaxed);
+    if (profiler_)
+      profiler_->recordCallback(us, period_us);
+  }
+
+  // Whether this callback may run the DSP chain (audio thread). Once faded
+  // out on pause it leaves the channel, the file position and the filter
+  // alone and hands them to step() on the UI thread, until unpaused; a
+  // callback that finds step() mid-write stays silent and asks again next time.
+  bool claimScope() {
+    if (paused_.load(std::memory_order_acquire) && chain_.gain() <= 0.0f) {
+      int owner = kOwnerAudio;
+      scope_owner_.compare_exchange_strong(owner, kOwnerFrozen,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed);
+      return false;
+    }
+    int owner = kOwnerFrozen;
+    if (scope_owner_.compare_exchange_strong(owner, kOwnerAudio,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed))
+      return true;
+    return owner == kOwnerAudio;
+  }
 
-    const float target_gain =
-        (paused_ || shutting_down_) ? 0.0f : volume_.load();
-    const float ramp_inc = 1.0f / (0.050f * sample_rate_);
+  void processBlock(const float *in, float *out, int num_frames) {
+    size_t total = audio_data_.numFrames();
 
-    for (unsigned int i = 0; i < framesPerBuffer; ++i) {
-      if (current_gain_ < target_gain)
-        current_gain_ = std::min(target_gain, current_gain_ + ramp_inc);
-      else if (current_gain_ > target_gain)
-        current_gain_ = std::max(target_gain, current_gain_ - ramp_inc);
+    // Snapshot shared state once per block
+    params_.update();
+    const bool paused = paused_.load(std::memory_order_relaxed);
 
-      bool is_running = !paused_ || current_gain_ > 0.0f;
+    // Fully faded out while paused: nothing advances
+    if (paused && chain_.gain() <= 0.0f) {
+      if (out)
+        std::fill(out, out + num_frames * 2, 0.0f);
+      return;
+    }
 
-      float l = 0.0f, r = 0.0f;
-      float speaker_l = 0.0f, speaker_r = 0.0f;
+    float in_l[kControlBlock], in_r[kControlBlock];
+    float trace_xy[2 * (kMaxTraces - 1)][kControlBlock];
+    const int traces = capturing_ || total == 0 ? 1 : numTraces();
 
-      if (is_running) {
-        if (total > 0) {
-          size_t idx = play_position_ % total;
-          l = audio_data_.left[idx];
-          r = audio_data_.stereo ? audio_data_.right[idx]
-                                 : audio_data_.left[idx];
-          play_position_++;
-        } else if (test_generator_) {
-          test_generator_->getSample(l, r);
+    if (capturing_) {
+      if (in && input_channels_ > 1) {
+        for (int i = 0; i < num_frames; ++i) {
+          in_l[i] = in[i * input_channels_];
+          in_r[i] = in[i * input_channels_ + 1];
         }
+      } else if (in) {
+        std::copy(in, in + num_frames, in_l);
+        std::copy(in, in + num_frames, in_r);
+      } else {
+        std::fill(in_l, in_l + num_frames, 0.0f);
+        std::fill(in_r, in_r + num_frames, 0.0f);
+      }
+    } else if (total > 0) {
+      // All traces' channels in one pass: trace 0 into in_l/in_r, which feed
+      // the filter and speakers, the others into trace_xy straight to the scope
+      int map[2 * kMaxTraces];
+      traceChannelMap(traces, map);
+      float *rows[2 * kMaxTraces] = {in_l, in_r};
+      for (int c = 2; c < 2 * traces; ++c)
+        rows[c] = trace_xy[c - 2];
+      if (resampling_) {
+        resampler_.processChannels(
+            rows, 2 * traces, num_frames, [&](float *const *dst, int count) {
+              audio_data_.readChannels(play_position_, map, dst, 2 * traces,
+                                       count);
+              play_position_ = (play_position_ + count) % total;
+            });
+      } else {
+        audio_data_.readChannels(play_position_, map, rows, 2 * traces,
+                                 num_frames);
+        play_position_ = (play_position_ + num_frames) % total;
+      }
+    } else if (test_generator_) {
+      test_generator_->generate(in_l, in_r, num_frames);
+    } else {
+      std::fill(in_l, in_l + num_frames, 0.0f);
+      std::fill(in_r, in_r + num_frames, 0.0f);
+    }
 
-        // For scope visualization: X = raw, Y = filtered (unless split mode)
-        float scope_l = l;
-        float scope_r = r;
-
-        // Speaker output values (default to raw if filter disabled)
-        speaker_l = l;
-        speaker_r = r;
-
-        if (filter_enabled_) {
-          // Update LFO phase and compute modulated cutoff
-          float lfo_freq = lfo_freq_.load(std::memory_order_relaxed);
-          float lfo_depth = lfo_depth_.load(std::memory_order_relaxed);
-
-          // Advance LFO phase (2*pi per cycle)
-          constexpr double kTwoPi = 2.0 * 3.14159265358979323846;
-          double phase_inc = kTwoPi * lfo_freq / sample_rate_;
-          lfo_phase_ += phase_inc;
-          if (lfo_phase_ >= kTwoPi)
-            lfo_phase_ -= kTwoPi;
-
-          // Calculate modulated cutoff (in octaves)
-          // modulated_cutoff = base_cutoff * 2^(depth * sin(phase))
-          float base_cutoff = filter_cutoff_.load(std::memory_order_relaxed);
-          double modulated_cutoff = base_cutoff;
-          if (lfo_depth > 0.0f) {
-            double mod_factor = std::pow(2.0, lfo_depth * std::sin(lfo_phase_));
-            modulated_cutoff = base_cutoff * mod_factor;
-            modulated_cutoff = std::clamp(
-                modulated_cutoff, static_cast<double>(kMinFilterCutoff),
-                static_cast<double>(kMaxFilterCutoff));
-          }
+    const float *trace_rows[2 * (kMaxTraces - 1)];
+    for (int c = 0; c < 2 * (traces - 1); ++c)
+      trace_rows[c] = trace_xy[c];
+
+    ScopeChain::Block block;
+    block.in_l = in_l;
+    block.in_r = in_r;
+    block.trace_xy = trace_rows;
+    block.extra_traces = traces - 1;
+    block.num_frames = num_frames;
+    block.filter = filter_enabled_.load(std::memory_order_relaxed);
+    block.write_scope = !paused;
+    block.threshold = trigger_threshold_.load(std::memory_order_relaxed);
+    block.rising = trigger_rising_.load(std::memory_order_relaxed);
+    block.target_gain =
+        (paused || shutting_down_) ? 0.0f : params_.value(kParamVolume);
+    block.ramp_inc = 1.0f / (0.050f * sample_rate_);
+    if (block.filter)
+      updateFilterBlock(num_frames);
+    chain_.process(block, out);
+  }
 
-          // Apply modulated cutoff to filters
-          svf_.setCutoff(modulated_cutoff);
-          stereo_router_.setCutoff(modulated_cutoff);
-
-          // Process GLOBAL filter once per sample (preserving state)
-          double mono = (static_cast<double>(l) + static_cast<double>(r)) * 0.5;
-          auto outputs = svf_.process(mono);
-
-          // 1. Calculate SCOPE values
-          if (morpher_.hasSplit()) {
-            // Split mode: both X and Y get offset-based filtering
-            auto xy = morpher_.applyXY(outputs.lp, outputs.bp, outputs.hp);
-            scope_l = static_cast<float>(xy.x);
-            scope_r = static_cast<float>(xy.y);
-          } else {
-            // No split: X = raw, Y = filtered with morpher
-            scope_r = static_cast<float>(
-                morpher_.apply(outputs.lp, outputs.bp, outputs.hp));
-          }
+  // Control-rate filter update: advance the LFO across the block and glide
+  // the SVF towards the cutoff it should reach by the end of the block
+  void updateFilterBlock(int num_frames) {
+    float lfo_freq = params_.value(kParamLfoFreq);
+    float lfo_depth = params_.value(kParamLfoDepth);
+    float base_cutoff = params_.value(kParamCutoff);
+
+    int oversampling = oversampling_.load(std::memory_order_relaxed);
+    if (oversampling != svf_.oversampling())
+      svf_.setOversampling(oversampling);
+
+    float resonance = params_.value(kParamResonance);
+    if (resonance != applied_resonance_) {
+      svf_.setResonance(resonance);
+      applied_resonance_ = resonance;
+    }
 
-          // 2. Calculate SPEAKER values (always filtered)
-          // Note: If no split, applyXY returns identical L/R based on main
-          // position
-          auto xy_speaker =
-              morpher_.applyXY(outputs.lp, outputs.bp, outputs.hp);
-          speaker_l = static_cast<float>(xy_speaker.x);
-          speaker_r = static_cast<float>(xy_speaker.y);
-        }
+    float pre_gain = params_.value(kParamPreGain);
+    if (pre_gain != applied_pre_gain_) {
+      svf_.setPreGain(pre_gain);
+      applied_pre_gain_ = pre_gain;
+    }
 
-        if (!paused_) {
-          // Write scope samples to ring buffer (X=raw, Y=filtered or split)
-          ring_buffer_.write(scope_l, scope_r);
-
-          // Trigger detection in audio thread
-          float thresh = trigger_threshold_.load(std::memory_order_relaxed);
-          bool rising = trigger_rising_.load(std::memory_order_relaxed);
-          bool crossed = rising
-                             ? (prev_trigger_l_ <= thresh && scope_l > thresh)
-                             : (prev_trigger_l_ >= thresh && scope_l < thresh);
-
-          bool find_trigger = (trigger_holdoff_ >= kSweepSamples);
-
-          if (crossed && find_trigger) {
-            // Waveform locking: find best match with reference
-            bool lock_enabled = trigger_lock_.load(std::memory_order_relaxed);
-            bool triggered = true;
-
-            if (triggered) {
-              latest_trigger_pos_.store(ring_buffer_.writePos() &
-                                            (RingBuffer::kSize - 1),
-                                        std::memory_order_release);
-              trigger_holdoff_ = 0;
-
-              // Update reference occasionally
-              if (reference_buffer_.size() != kSweepSamples)
-                reference_buffer_.resize(kSweepSamples);
-              for (int j = 0; j < kSweepSamples; ++j)
-                reference_buffer_[j] = ring_buffer_.readLeftAt(
-                    (latest_trigger_pos_.load() + j) & (RingBuffer::kSize - 1));
-            }
-          }
+    // Advance LFO phase (2*pi per cycle)
+    constexpr double kTwoPi = 2.0 * 3.14159265358979323846;
+    lfo_phase_ += kTwoPi * lfo_freq * num_frames / sample_rate_;
+    if (lfo_phase_ >= kTwoPi)
+      lfo_phase_ -= kTwoPi;
+
+    // Calculate modulated cutoff (in octaves)
+    // modulated_cutoff = base_cutoff * 2^(depth * sin(phase))
+    double modulated_cutoff = base_cutoff;
+    if (lfo_depth > 0.0f) {
+      double mod_factor = std::pow(2.0, lfo_depth * std::sin(lfo_phase_));
+      modulated_cutoff = std::clamp(base_cutoff * mod_factor,
+                                    static_cast<double>(kMinFilterCutoff),
+                                    static_cast<double>(kMaxFilterCutoff));
+    }
 
-          prev_trigger_l_ = scope_l;
-          trigger_holdoff_++;
-        }
-      }
+    svf_.rampCutoff(modulated_cutoff, num_frames);
+  }
+
+#if VISAGE_EMSCRIPTEN
+  SDL_AudioDeviceID device_ = 0;
+#if FAVEWORM_WORKLET
+  // Stopped, Running, or Busy while the worklet is inside process()
+  enum WorkletState { kWorkletStopped, kWorkletRunning, kWorkletBusy };
+  static constexpr int kWorkletStackSize = 64 * 1024;
+  EMSCRIPTEN_WEBAUDIO_T audio_context_ = 0;
+  EMSCRIPTEN_AUDIO_WORKLET_NODE_T worklet_node_ = 0; // Once created (UI)
+  int worklet_rate_ = 44100;
+  std::atomic<int> worklet_state_{kWorkletStopped};
+  alignas(16) uint8_t worklet_stack_[kWorkletStackSize];
+#endif
+#else
+  PaStream *stream_ = nullptr;
+#endif
+
+  AudioData audio_data_;
+  static constexpr double kHistorySeconds = 1.0; // Scope history at any rate
+  ScopeChannel channel_;
+  std::atomic<size_t> play_position_{0}; // Also read by prefetch()
+  dfl::Resampler resampler_; // File rate -> stream rate, all trace channels
+  bool resampling_ = false;
+  std::atomic<bool> is_playing_{false};
+
+  // Run all DSP at the stream rate, resampling the file if it differs.
+  // Called with the stream stopped.
+  void configureRate(double sr) {
+    sample_rate_ = static_cast<float>(sr);
+    params_.setBlockRate(sr / kControlBlock);
+    svf_.setSampleRate(sr);
+    stereo_router_.setSampleRate(sr);
+    if (test_generator_)
+      test_generator_->setSampleRate(sr);
+
+    const int traces = fileTraces();
+    if (traces - 1 != channel_.extraTraces())
+      channel_.setExtraTraces(traces - 1);
+    if (resampler_.getChannels() != 2 * traces)
+      resampler_.setChannels(2 * traces);
+
+    resampling_ = !audio_data_.empty() && audio_data_.sampleRate() != sr;
+    if (resampling_)
+      resampler_.setRates(audio_data_.sampleRate(), sr);
+    prepareChannel();
+  }
+
+  // Traces the loaded file has channels for: one per channel pair
+  int fileTraces() const {
+    const int pairs = (audio_data_.numChannels() + 1) / 2;
+    return std::clamp(pairs, 1, kMaxTraces);
+  }
+
+  // File channels for the first traces (X then Y for each), once per block.
+  // Mono plays its channel on both axes, as read() does.
+  void traceChannelMap(int traces, int *map) const {
+    const bool mono = audio_data_.numChannels() == 1;
+    for (int t = 0; t < traces; ++t) {
+      const int packed = trace_channels_[t].load(std::memory_order_relaxed);
+      map[2 * t] = mono ? 0 : packed & 0xff;
+      map[2 * t + 1] = mono ? 0 : packed >> 8;
+    }
+  }
+
+  // Size the scope history for the stream rate. Called with the stream
+  // stopped; a rate that needs a different ring clears the history.
+  void prepareChannel() {
+    size_t frames = static_cast<size_t>(kHistorySeconds * sample_rate_);
+    if (ScopeChannel::capacityFor(frames) == channel_.capacity())
+      return;
+
+    std::lock_guard<std::mutex> lock(lock_mutex_);
+    channel_.setCapacity(frames);
+    chain_.resetTrigger();
+    frame_end_ = frame_trigger_ = candidate_trigger_ = shown_trigger_ = 0;
+    locked_pos_ = 0;
+    lock_reset_ = true;
+  }
+
+  // Start of the sweep a len-sample trigger window shows, or 0 for none
+  // (UI thread). A candidate trigger (the lock, else the newest level
+  // trigger) is held until its window is complete at the frame position,
+  // and the previous sweep stays up meanwhile, like a scope in normal
+  // trigger mode.
+  size_t triggerStart(size_t len) {
+#if !FAVEWORM_THREADS
+    // No worker thread on the web build: lock once per frame instead
+    updateLock();
+#endif
+    const size_t end = frame_end_;
+    auto inRange = [&](size_t pos) {
+      return pos != 0 && pos <= end && end - pos <= channel_.capacity() / 2;
+    };
+    auto usable = [&](size_t pos) { return inRange(pos) && pos + len <= end; };
+
+    size_t newest = frame_trigger_;
+    size_t locked =
+        offline_ ? frame_locked_ : locked_pos_.load(std::memory_order_acquire);
+    if (trigger_lock_.load(std::memory_order_relaxed) && locked != 0)
+      newest = locked;
+
+    // Waiting candidates lie ahead of the frame position; replace stale ones
+    if (candidate_trigger_ == 0 ||
+        (candidate_trigger_ <= end && !inRange(candidate_trigger_)))
+      candidate_trigger_ = newest;
+    if (usable(candidate_trigger_)) {
+      shown_trigger_ = candidate_trigger_;
+      candidate_trigger_ = newest;
+    }
+    return usable(shown_trigger_) ? shown_trigger_ : 0;
+  }
+
+  // Start of the sweep a len-sample trigger window showed offset samples
+  // before the frame position, or 0 for none (UI thread). Leaves the live
+  // trigger hold alone: the newest published trigger or lock that fits
+  // there wins, else the last level crossing in the sweep before it, found
+  // in scratch (len floats).
+  size_t pastTriggerStart(size_t len, size_t offset, float *scratch) {
+    const size_t end = frame_end_ - std::min(offset, frame_end_);
+    auto usable = [&](size_t pos) {
+      return pos != 0 && pos + len <= end &&
+             end - pos <= channel_.capacity() / 2;
+    };
+    const size_t locked =
+        offline_ ? frame_locked_ : locked_pos_.load(std::memory_order_acquire);
+    size_t best = 0;
+    for (size_t pos : {shown_trigger_, candidate_trigger_, frame_trigger_,
+                       trigger_lock_.load(std::memory_order_relaxed) ? locked
+                                                                     : 0})
+      if (usable(pos))
+        best = std::max(best, pos);
+    if (best != 0 || end < 2 * len + 1)
+      return best;
+
+    // Every start in [end - 2 len, end - len) leaves the whole window in
+    const size_t first = end - 2 * len;
+    if (!channel_.read(first, scratch, nullptr, static_cast<int>(len)))
+      return 0;
+    const float thresh = trigger_threshold_.load(std::memory_order_relaxed);
+    const bool rising = trigger_rising_.load(std::memory_order_relaxed);
+    for (size_t i = len - 1; i >= 1; --i) {
+      const float a = scratch[i - 1];
+      const float b = scratch[i];
+      if (rising ? (a <= thresh && b > thresh) : (a >= thresh && b < thresh))
+        return first + i;
+    }
+    return 0;
+  }
+
+  // Start the file's levels over. Nothing is read here, so a load costs the
+  // same whatever the file's length: prefetch() sizes the pyramid and then
+  // fills it in a bounded chunk each frame.
+  void buildFileLevels() {
+    file_levels_ = LevelPyramid();
+    file_levels_end_ = 0;
+  }
+
+  // Catch the file's levels up with what can be read of it, at most
+  // max_frames at a time (UI thread). A WAV is readable from the start; a
+  // compressed file as far as it has decoded.
+  void extendFileLevels(size_t max_frames) {
+    if (file_levels_.empty()) {
+      size_t capacity = 1;
+      while (capacity < audio_data_.numFrames())
+        capacity <<= 1;
+      file_levels_.setCapacity(capacity, kFileLevelBaseFrames);
+    }
+    const size_t ready = std::min(audio_data_.framesReady(),
+                                  file_levels_end_ + max_frames);
+    float l[4096], r[4096];
+    while (file_levels_end_ < ready) {
+      int n = static_cast<int>(
+          std::min<size_t>(4096, ready - file_levels_end_));
+      audio_data_.read(file_levels_end_, l, r, n);
+      for (int i = 0; i < n; ++i)
+        file_levels_.push(l[i]);
+      file_levels_end_ += n;
+    }
+  }
+
+  // step() writes from the UI thread while frozen; show its result at once
+  void publishStep() {
+    channel_.publish(0, 0, ScopeChannel::now());
+    frame_end_ = channel_.head();
+  }
+
+#if FAVEWORM_THREADS
+  // The lock worker runs only while the lock is on, and sleeps until a
+  // callback publishes new audio (UI thread)
+  void startLockWorker() {
+    if (lock_thread_.joinable())
+      return;
+    lock_running_ = true;
+    lock_pending_ = true; // Lock on what is already there
+    lock_thread_ = std::thread([this] { runLockWorker(); });
+  }
 
-      out[i * 2] = speaker_l * current_gain_;
-      out[i * 2 + 1] = speaker_r * current_gain_;
+  void stopLockWorker() {
+    if (!lock_thread_.joinable())
+      return;
+    {
+      std::lock_guard<std::mutex> lock(lock_wake_mutex_);
+      lock_running_ = false;
     }
+    lock_wake_.notify_one();
+    lock_thread_.join();
   }
 
-#if VISAGE_EMSCRIPTEN
-  SDL_AudioDeviceID device_ = 0;
-#else
-  PaStream *stream_ = nullptr;
+  // Audio thread: no mutex is taken, so a wake-up that races the worker
+  // going to sleep is lost and the lock waits for the next callback instead
+  void wakeLockWorker() {
+    if (offline_.load(std::memory_order_relaxed) ||
+        !lock_running_.load(std::memory_order_relaxed))
+      return;
+    lock_pending_.store(true, std::memory_order_release);
+    lock_wake_.notify_one();
+  }
+
+  // One update per wake-up, at most one per kLockIntervalMs: callbacks
+  // arriving faster than that are coalesced
+  void runLockWorker() {
+    std::unique_lock<std::mutex> lock(lock_wake_mutex_);
+    while (true) {
+      lock_wake_.wait(lock, [&] {
+        return !lock_running_ || lock_pending_.load(std::memory_order_acquire);
+      });
+      if (!lock_running_)
+        return;
+      lock_pending_ = false;
+
+      lock.unlock();
+      if (!offline_)
+        updateLock();
+      lock.lock();
+      lock_wake_.wait_for(lock, std::chrono::milliseconds(kLockIntervalMs),
+                          [&] { return !lock_running_; });
+    }
+  }
 #endif
 
-  AudioData audio_data_;
-  RingBuffer ring_buffer_;
-  size_t play_position_ = 0;
-  bool is_playing_ = false;
-
-  // Trigger state (audio thread)
-  float prev_trigger_l_ = 0.0f;
-  int trigger_holdoff_ = 0;
-  std::vector<float> reference_buffer_;
-  std::atomic<size_t> latest_trigger_pos_{0};
+  // Correlate the newest ring contents against the locked reference and
+  // publish the best matching window start (lock worker / web UI thread)
+  void updateLock() {
+    if (!trigger_lock_.load(std::memory_order_relaxed) ||
+        paused_.load(std::memory_order_relaxed))
+      return;
+    std::lock_guard<std::mutex> lock(lock_mutex_);
+    if (lock_reset_.exchange(false))
+      locker_.reset();
+
+    size_t end = channel_.writePos();
+    if (end < static_cast<size_t>(WaveformLocker::kSnapshotSize) ||
+        !channel_.read(end - WaveformLocker::kSnapshotSize,
+                       lock_snapshot_.data(), nullptr,
+                       WaveformLocker::kSnapshotSize))
+      return;
+
+    int k = locker_.update(lock_snapshot_.data(),
+                           trigger_threshold_.load(std::memory_order_relaxed),
+                           trigger_rising_.load(std::memory_order_relaxed));
+    if (k >= 0)
+      locked_pos_.store(end - WaveformLocker::kSnapshotSize + k,
+                        std::memory_order_release);
+  }
+
+  // Display frame state (UI thread)
+  size_t frame_end_ = 0;
+  size_t frame_trigger_ = 0;
+  size_t candidate_trigger_ = 0;
+  size_t shown_trigger_ = 0;
+  size_t frame_locked_ = 0; // Offline only
+  std::atomic<bool> offline_{false};
+
+  // Whole-file levels for long timebases
+  static constexpr size_t kFileLevelBaseFrames = 64;
+  static constexpr size_t kLevelFramesPerDraw = 1 << 18; // Levels per frame
+  LevelPyramid file_levels_;
+  size_t file_levels_end_ = 0; // Frames of the file the levels cover
+
+  // Waveform lock (worker)
+  static constexpr int kLockIntervalMs = 5; // Shortest time between updates
+  std::mutex lock_mutex_; // Lock worker vs. channel resize
+  WaveformLocker locker_;
+  std::vector<float> lock_snapshot_ =
+      std::vector<float>(WaveformLocker::kSnapshotSize);
+  std::atomic<size_t> locked_pos_{0};
+  std::atomic<bool> lock_reset_{false};
+#if FAVEWORM_THREADS
+  std::mutex lock_wake_mutex_;
+  std::condition_variable lock_wake_;
+  std::atomic<bool> lock_running_{false};
+  std::atomic<bool> lock_pending_{false}; // New audio since the last update
+  std::thread lock_thread_;
+#endif
   std::atomic<float> trigger_threshold_{0.0f};
   std::atomic<bool> trigger_rising_{true};
   std::atomic<bool> trigger_lock_{true};
 
 public:
   // Filter controls
+  // The audio thread glides to cutoff/resonance from its next control block
   void setFilterCutoff(float fc) {
-    filter_cutoff_ = std::clamp(fc, kMinFilterCutoff, kMaxFilterCutoff);
-    svf_.setCutoff(filter_cutoff_);
-    stereo_router_.setCutoff(filter_cutoff_);
+    params_.set(kParamCutoff, fc);
+    stereo_router_.setCutoff(params_.get(kParamCutoff));
   }
-  float filterCutoff() const { return filter_cutoff_; }
+  float filterCutoff() const { return params_.get(kParamCutoff); }
 
   void setFilterResonance(float r) {
-    filter_resonance_ = std::clamp(r, kMinFilterResonance, kMaxFilterResonance);
-    svf_.setResonance(filter_resonance_);
-    stereo_router_.setResonance(filter_resonance_);
+    params_.set(kParamResonance, r);
+    stereo_router_.setResonance(params_.get(kParamResonance));
   }
-  float filterResonance() const { return filter_resonance_; }
+  float filterResonance() const { return params_.get(kParamResonance); }
 
   void setFilterEnabled(bool enabled) { filter_enabled_ = enabled; }
   bool filterEnabled() const { return filter_enabled_; }
 
+  // Applied by the audio thread at its next control block
+  void setOversampling(int factor) {
+    oversampling_ = factor >= 4 ? 4 : (factor >= 2 ? 2 : 1);
+  }
+  int oversampling() const { return oversampling_; }
+
   void setStereoSplitMode(bool enabled) { stereo_split_mode_ = enabled; }
   bool stereoSplitMode() const { return stereo_split_mode_; }
   void cycleSplitMode() { stereo_router_.cycleSplitMode(); }
@@ -993,14 +1834,13 @@ public:
   StereoFilterRouter &stereoRouter() { return stereo_router_; }
 
   // Filter state
-  mutable SimpleSVF svf_;
+  mutable OversampledSVF svf_;
   FilterMorpher morpher_;
   mutable StereoFilterRouter stereo_router_;
-  std::atomic<float> filter_cutoff_{kDefaultFilterCutoff};
-  std::atomic<float> filter_resonance_{kDefaultFilterResonance};
   std::atomic<bool> filter_enabled_{true};
+  std::atomic<int> oversampling_{1}; // SVF oversampling factor (1, 2 or 4)
   std::atomic<bool> stereo_split_mode_{false};
-  std::atomic<float> pre_gain_{kDefaultPreGain};
+  ScopeChain chain_{svf_, morpher_, channel_}; // Block chain (audio thread)
 
   // RPM controls
   void setBeta(float b) {
@@ -1013,47 +1853,81 @@ public:
   }
 
   void setPreGain(float v) {
-    pre_gain_ = v;
-    svf_.setPreGain(v);
-    stereo_router_.setPreGain(v);
+    params_.set(kParamPreGain, v);
+    stereo_router_.setPreGain(params_.get(kParamPreGain));
   }
-  float preGain() const { return pre_gain_; }
+  float preGain() const { return params_.get(kParamPreGain); }
 
   // LFO controls for filter cutoff modulation
-  void setLfoFreq(float freq) {
-    lfo_freq_ = std::clamp(freq, kMinLfoFreq, kMaxLfoFreq);
-  }
-  float lfoFreq() const { return lfo_freq_; }
+  void setLfoFreq(float freq) { params_.set(kParamLfoFreq, freq); }
+  float lfoFreq() const { return params_.get(kParamLfoFreq); }
 
-  void setLfoDepth(float depth) {
-    lfo_depth_ = std::clamp(depth, kMinLfoDepth, kMaxLfoDepth);
-  }
-  float lfoDepth() const { return lfo_depth_; }
+  void setLfoDepth(float depth) { params_.set(kParamLfoDepth, depth); }
+  float lfoDepth() const { return params_.get(kParamLfoDepth); }
 
   bool use_speaker_ = false;
+  bool live_input_ = false;
+  int input_device_ = -1;
+  int buffer_frames_ = 0; // 0 = default for the current mode
+  // Fixed while a stream is open, so the audio thread reads them freely
+  bool capturing_ = false;
+  int input_channels_ = 2;
   TestSignalGenerator *test_generator_ = nullptr;
-  float current_gain_ = 0.0f;
+  Profiler *profiler_ = nullptr;
+  std::atomic<float> callback_load_{0.0f}; // Last callback / buffer period
+  std::atomic<int> num_traces_{kMaxTraces}; // Requested; see numTraces()
+  std::atomic<int> trace_channels_[kMaxTraces] = {
+      {0 | 1 << 8}, {2 | 3 << 8}, {4 | 5 << 8}, {6 | 7 << 8}};
+  size_t window_start_ = 0; // Of the last getCurrent/TriggeredSamples (UI)
   std::atomic<bool> paused_{false};
+  // Producer of channel_ (with the file position and filter state): the
+  // audio thread, or nobody once it froze on pause, or a step() under way
+  enum ScopeOwner { kOwnerAudio, kOwnerFrozen, kOwnerStep };
+  std::atomic<int> scope_owner_{kOwnerAudio};
+  int deferred_step_ = 0; // UI thread: samples step() still has to move
   std::atomic<bool> shutting_down_{false};
-  std::atomic<float> volume_{0.0f};
+  ParamBank<kNumAudioParams> params_{kAudioParamSpecs};
   float sample_rate_ = 44100.0f;
 
   // LFO state
-  std::atomic<float> lfo_freq_{kDefaultLfoFreq};
-  std::atomic<float> lfo_depth_{kDefaultLfoDepth};
   double lfo_phase_ = 0.0; // Phase accumulator (0 to 2*pi)
+  float applied_resonance_ = 1.0f; // Last resonance given to svf_ (audio)
+  float applied_pre_gain_ = 1.0f;  // Last pre-gain given to svf_ (audio)
+};
+
+// Calls back on the UI thread every interval while started
+class CallbackTimer : public visage::EventTimer {
+public:
+  explicit CallbackTimer(std::function<void()> callback)
+      : callback_(std::move(callback)) {}
+
+  void timerCallback() override { callback_(); }
+
+private:
+  std::function<void()> callback_;
 };
 
 class Oscilloscope : public visage::Frame {
 public:
   static constexpr float kPi = 3.14159265358979323846f;
   static constexpr int kHistoryFrames = 4;
-#if VISAGE_EMSCRIPTEN
-  static constexpr float kMaxDist = 1.6f;
-  static constexpr int kOversampleRate = 8;
+  static constexpr int kMaxFrameSamples = 1024; // Largest generated frame
+  static constexpr double kTrailFrameSeconds = 0.016; // Step trail spacing
+  static constexpr int kMinSweepSamples = 8;
+  static constexpr int kLevelColumns = kMaxFrameSamples / 2; // Envelope strokes
+  static constexpr double kDefaultTimebase = 512.0 / 44100.0; // Seconds
+  static constexpr double kMinTimebase = 0.0001;
+  static constexpr double kMaxTimebase = 30.0;
+  static constexpr float kPhosphorFloor = 0.003f; // Of the beam; dimmer drop
+  static constexpr float kCoalesceReach = 0.25f; // Pixels; drawn as one splat
+  static constexpr int kIdleFrames = 60;   // Unchanged frames before idling
+  static constexpr int kIdlePollMs = 30;   // Wake check interval while idle
+  static constexpr int kIdleProbeSamples = 256;
+  static constexpr float kIdleTolerance = 1e-3f; // Smaller moves don't count
+#if !FAVEWORM_THREADS
+  static constexpr QualityProfile kQuality = kWebQuality;
 #else
-  static constexpr float kMaxDist = 1.5f;
-  static constexpr int kOversampleRate = 16;
+  static constexpr QualityProfile kQuality = kDesktopQuality;
 #endif
 
   struct Sample {
@@ -1063,6 +1937,27 @@ public:
   Oscilloscope() {
     setIgnoresMouseEvents(true, false);
     // Demo mode: synthetic waveform if nothing else
+
+    // Size every per-frame buffer up front so draw() never allocates
+    scratch_left_.resize(kMaxFrameSamples);
+    scratch_right_.resize(kMaxFrameSamples);
+    levels_.resize(kLevelColumns);
+    current_samples_.reserve(kMaxFrameSamples);
+    idle_samples_[0].reserve(kMaxFrameSamples);
+    for (auto &frame : history_)
+      frame.reserve(kMaxFrameSamples);
+    splats_.reserve(kQuality.max_splats + kMaxFrameSamples);
+    phosphor_.reserve(kQuality.max_phosphor_splats + kQuality.max_splats +
+                      kMaxFrameSamples);
+    splatter_.setPool(&splat_pool_);
+
+    for (int h = 0; h < BeamSplatter::kHueSteps; ++h) {
+      visage::Color c =
+          visage::Color::fromAHSV(1.0f, static_cast<float>(h), 0.85f, 1.0f);
+      hue_rgb_[h][0] = c.red();
+      hue_rgb_[h][1] = c.green();
+      hue_rgb_[h][2] = c.blue();
+    }
   }
 
   bool receivesDragDropFiles() override { return true; }
@@ -1077,7 +1972,11 @@ public:
     }
   }
 
-  void setPhosphorEnabled(bool enabled) { phosphor_enabled_ = enabled; }
+  void setPhosphorEnabled(bool enabled) {
+    phosphor_enabled_ = enabled;
+    phosphor_.clear();
+    splats_.clear();
+  }
   bool phosphorEnabled() const { return phosphor_enabled_; }
   void setPhosphorDecay(float decay) { phosphor_decay_ = decay; }
   void setBeamSize(float size) { beam_size_ = size; }
@@ -1091,19 +1990,30 @@ public:
 
   void setCrtIntensity(float intensity) {
     crt_intensity_ = intensity;
-    if (intensity > 0.001f) {
-      if (!crt_effect_) {
-        crt_effect_ = std::make_unique<visage::ShaderPostEffect>(
-            resources::shaders::vs_custom, resources::shaders::fs_crt);
-      }
-      crt_effect_->setUniformValue("u_crt_params", intensity, 0.0f, 0.0f, 0.0f);
-      setPostEffect(crt_effect_.get());
-    } else {
-      setPostEffect(nullptr);
-    }
+    updatePostEffect();
   }
   float crtIntensity() const { return crt_intensity_; }
 
+  // Glitch, warp, sepia and gray scale share the CRT's fused pass
+  void setPostStage(PostChain::Stage stage, float intensity) {
+    post_chain_.set(stage, intensity);
+    updatePostEffect();
+  }
+
+  // Frame-time budget the quality governor holds; 0 keeps full quality
+  void setFrameBudget(double ms) {
+    governor_.setTargetMs(ms);
+    qualityChanged();
+  }
+  double frameBudget() const { return governor_.targetMs(); }
+  const QualityGovernor &governor() const { return governor_; }
+
+  // Called when the governor steps the bloom levels (the bloom effect belongs
+  // to the window)
+  void setBloomLevelsCallback(std::function<void(int)> callback) {
+    bloom_levels_callback_ = std::move(callback);
+  }
+
   void setSlew(float slew) { slew_ = slew; }
   float slew() const { return slew_; }
 
@@ -1113,6 +2023,19 @@ public:
   void setBetaStepCoupled(bool coupled) { beta_step_coupled_ = coupled; }
   bool betaStepCoupled() const { return beta_step_coupled_; }
 
+  // Analytic beam: exact segment integral, ignores step_mult_/beta coupling
+  void setAnalyticBeam(bool analytic) {
+    analytic_beam_ = analytic;
+    phosphor_.clear();
+    splats_.clear();
+  }
+  bool analyticBeam() const { return analytic_beam_; }
+
+  void setTimebase(double seconds) {
+    timebase_ = std::clamp(seconds, kMinTimebase, kMaxTimebase);
+  }
+  double timebase() const { return timebase_; }
+
   void setDisplayMode(DisplayMode mode) { display_mode_ = mode; }
   DisplayMode displayMode() const { return display_mode_; }
   void cycleDisplayMode() {
@@ -1149,6 +2072,11 @@ public:
   bool waveformLock() const { return waveform_lock_; }
 
   void setAudioPlayer(AudioPlayer *player) { audio_player_ = player; }
+  void setProfiler(Profiler *profiler) {
+    profiler_ = profiler;
+    if (profiler_)
+      profiler_->setSplatBudget(governor_.splatBudget());
+  }
 
   // SVF controls
   // SVF controls delegates
@@ -1196,35 +2124,22 @@ public:
   void step() {
     needs_step_update_ = true;
 
-    // Regenerate phosphor history to show motion blur
-    // Generate a few frames at slightly offset positions
-#if VISAGE_EMSCRIPTEN
-    const int trail_frames = 8;
-#else
-    const int trail_frames = 800000;
-#endif
-
-    // Clear all history first
-    for (int i = 0; i < kHistoryFrames; ++i) {
-      history_[i].clear();
-    }
-
-    // Generate trail frames by temporarily offsetting time
-    double original_offset = time_offset_;
-    for (int i = 0; i < trail_frames; ++i) {
-      // Offset backwards in time for each trail frame
-      // Each frame is offset by ~16ms (assuming 60fps)
-      time_offset_ = original_offset - (trail_frames - i) * 0.016;
-
-      int idx = (history_index_ + i) % kHistoryFrames;
-      generateWaveform(0.0, history_[idx]);
+    // Regenerate phosphor history to show motion blur. Only the slots that
+    // are actually shown get rebuilt, each read directly from its own point
+    // in the past (one display frame apart) rather than replaying every
+    // frame in between.
+    const int frame_samples =
+        audio_player_ ? static_cast<int>(std::lround(
+                            kTrailFrameSeconds * audio_player_->sampleRate()))
+                      : 0;
+
+    for (int age = kHistoryFrames - 1; age >= 1; --age) {
+      int idx = (history_index_ - age + kHistoryFrames) % kHistoryFrames;
+      generateWaveform(last_time_ + time_offset_ - age * kTrailFrameSeconds,
+                       history_[idx], age * frame_samples);
     }
 
-    // Restore original time offset
-    time_offset_ = original_offset;
-
-    // Update history index to point after the trail frames
-    history_index_ = (history_index_ + trail_frames) % kHistoryFrames;
+    rebuild_phosphor_ = true;
   }
 
   // Stereo split mode delegates
@@ -1249,16 +2164,24 @@ public:
   void setTestSignalEnabled(bool enabled) { test_signal_enabled_ = enabled; }
   bool testSignalEnabled() const { return test_signal_enabled_; }
 
-  void generateWaveform(double time, std::vector<Sample> &samples) {
+  // sample_offset reads further back in the ring buffer (used for history)
+  void generateWaveform(double time, std::vector<Sample> &samples,
+                        int sample_offset = 0) {
     // Note: This now generates NORMALIZED coordinates (-1 to 1 range typically)
-    // they are mapped to screen pixels in renderWaveform.
+    // they are mapped to screen pixels in generateSplats.
+    if (sample_offset == 0)
+      trace_window_ = 0;
 
     // Use audio player data for all primary modes
     if (audio_player_ && audio_player_->isPlaying()) {
       if (display_mode_ == DisplayMode::XY) {
-        const int num_samples = 1024;
-        std::vector<float> left, right;
-        audio_player_->getCurrentSamples(left, right, num_samples);
+        const int num_samples = kMaxFrameSamples;
+        float *left = scratch_left_.data();
+        float *right = scratch_right_.data();
+        audio_player_->getCurrentSamples(left, right, num_samples,
+                                         sample_offset);
+        if (sample_offset == 0)
+          trace_window_ = num_samples;
 
         samples.resize(num_samples);
         for (int i = 0; i < num_samples; ++i) {
@@ -1281,10 +2204,14 @@ public:
           }
         }
         return;
+      } else if (generateLevels(samples, sample_offset)) {
+        return;
       } else if (display_mode_ == DisplayMode::TimeTrigger) {
-        const int num_samples = 512;
-        std::vector<float> audio;
-        audio_player_->getTriggeredSamples(audio, num_samples);
+        const int num_samples = sweepSamples();
+        float *audio = scratch_left_.data();
+        audio_player_->getTriggeredSamples(audio, num_samples, sample_offset);
+        if (sample_offset == 0)
+          trace_window_ = num_samples;
 
         samples.resize(num_samples);
         for (int i = 0; i < num_samples; ++i) {
@@ -1293,9 +2220,13 @@ public:
         }
         return;
       } else if (display_mode_ == DisplayMode::TimeFree) {
-        const int num_samples = 512;
-        std::vector<float> left, right;
-        audio_player_->getCurrentSamples(left, right, num_samples);
+        const int num_samples = sweepSamples();
+        float *left = scratch_left_.data();
+        float *right = scratch_right_.data();
+        audio_player_->getCurrentSamples(left, right, num_samples,
+                                         sample_offset);
+        if (sample_offset == 0)
+          trace_window_ = num_samples;
 
         samples.resize(num_samples);
         for (int i = 0; i < num_samples; ++i) {
@@ -1357,8 +2288,93 @@ public:
     }
   }
 
-  void renderWaveform(visage::Canvas &canvas,
-                      const std::vector<Sample> &samples, float alpha_mult) {
+  // The extra traces of a multichannel file, over the window the main trace
+  // just read: XY plots each channel pair, time modes sweep each X channel.
+  // Only the main X channel has level pyramids, so an envelope frame
+  // (generateLevels) leaves trace_window_ at 0 and draws no extra traces.
+  void generateTraces() {
+    num_traces_ = audio_player_ && trace_window_ > 0
+                      ? audio_player_->numTraces() - 1
+                      : 0;
+    const int n = trace_window_;
+    float *x = scratch_left_.data();
+    float *y = scratch_right_.data();
+    for (int t = 0; t < num_traces_; ++t) {
+      audio_player_->getTraceSamples(t + 1, x, y, n);
+      std::vector<Sample> &samples = trace_samples_[t];
+      samples.resize(n);
+      for (int i = 0; i < n; ++i) {
+        const float sx = std::isfinite(x[i]) ? std::clamp(x[i], -2.0f, 2.0f)
+                                             : 0.0f;
+        const float sy = std::isfinite(y[i]) ? std::clamp(y[i], -2.0f, 2.0f)
+                                             : 0.0f;
+        if (display_mode_ == DisplayMode::XY)
+          samples[i] = {sx, sy};
+        else
+          samples[i] = {static_cast<float>(i) / (n - 1), sx};
+      }
+    }
+  }
+
+  // Colour of extra trace t (1 or more), in degrees from the main hue
+  void setTraceHue(int t, float degrees) {
+    if (t >= 1 && t < AudioPlayer::kMaxTraces)
+      trace_hue_offset_[t - 1] = std::clamp(degrees, 0.0f, 360.0f);
+  }
+
+  // Sweep length in samples for the timebase (sample by sample sweeps)
+  int sweepSamples() const {
+    double n = std::round(timebase_ * audio_player_->sampleRate());
+    return static_cast<int>(std::clamp(n, static_cast<double>(kMinSweepSamples),
+                                       static_cast<double>(kMaxFrameSamples)));
+  }
+
+  // Timebases too long to draw sample by sample show the min/max envelope
+  // instead: each column is a stroke from its minimum to its maximum, so the
+  // frame costs the same however much signal it covers.
+  bool generateLevels(std::vector<Sample> &samples, int sample_offset) {
+    size_t len = static_cast<size_t>(
+        std::llround(timebase_ * audio_player_->sampleRate()));
+    if (!audio_player_->needsLevels(len, kLevelColumns))
+      return false;
+
+    LevelPyramid::Bucket *columns = levels_.data();
+    bool triggered = display_mode_ == DisplayMode::TimeTrigger;
+    if (!audio_player_->getLevels(len, kLevelColumns, triggered, sample_offset,
+                                  columns))
+      std::fill(levels_.begin(), levels_.end(), LevelPyramid::Bucket());
+
+    samples.resize(2 * kLevelColumns);
+    for (int c = 0; c < kLevelColumns; ++c) {
+      float x = static_cast<float>(c) / (kLevelColumns - 1);
+      samples[2 * c] = {x, std::clamp(columns[c].lo, -2.0f, 2.0f)};
+      samples[2 * c + 1] = {x, std::clamp(columns[c].hi, -2.0f, 2.0f)};
+    }
+    return true;
+  }
+
+  // The current frame with every trace in one splat list, so they go to the
+  // GPU in the same batched draw. Traces share the splat budget.
+  void generateFrameSplats(float alpha_mult, std::vector<BeamSplat> &out) {
+    const int traces = 1 + num_traces_;
+    out.clear();
+    appendSplats(current_samples_, alpha_mult, 0.0f, traces, out);
+    for (int t = 0; t < num_traces_; ++t)
+      appendSplats(trace_samples_[t], alpha_mult, trace_hue_offset_[t], traces,
+                   out);
+  }
+
+  // Interpolate a sample frame into beam splats (no Canvas work)
+  void generateSplats(const std::vector<Sample> &samples, float alpha_mult,
+                      std::vector<BeamSplat> &out) {
+    out.clear();
+    appendSplats(samples, alpha_mult, 0.0f, 1, out);
+  }
+
+  // As generateSplats, after what out holds, turned hue_offset degrees round
+  // the colour wheel and with a 1/share part of the splat budget
+  void appendSplats(const std::vector<Sample> &samples, float alpha_mult,
+                    float hue_offset, int share, std::vector<BeamSplat> &out) {
     if (samples.size() < 2)
       return;
 
@@ -1367,104 +2383,245 @@ public:
     if (w <= 0 || h <= 0)
       return;
 
-    auto toPixel = [&](const Sample &s) -> Sample {
-      Sample p;
-      if (display_mode_ == DisplayMode::XY) {
-        float cx = w * 0.5f;
-        float cy = h * 0.5f;
-        float base_scale = std::min(w, h) * 0.4f * post_scale_;
-
-        float rad = post_rotate_ * kPi / 180.0f;
-        float sn = std::sin(rad);
-        float cs = std::cos(rad);
-
-        float rx = s.x * cs - s.y * sn;
-        float ry = s.x * sn + s.y * cs;
-
-        p.x = cx + rx * base_scale;
-        p.y = cy - ry * base_scale;
-      } else {
-        float cy = h * 0.5f;
-        float base_scale = h * 0.4f * post_scale_;
-        p.x = s.x * w;
-        p.y = cy - s.y * base_scale;
-      }
-      return p;
+    // Sample to pixel space is one affine map per frame: rotation and scale
+    // folded into a 2x2 matrix (y flipped so up is up), then the offset
+    float m00, m01, m10, m11, ox, oy;
+    float unit_px; // Pixels per signal unit, for density estimates
+    if (display_mode_ == DisplayMode::XY) {
+      const float base_scale = std::min(w, h) * 0.4f * post_scale_;
+      unit_px = base_scale;
+      const float rad = post_rotate_ * kPi / 180.0f;
+      const float sn = std::sin(rad) * base_scale;
+      const float cs = std::cos(rad) * base_scale;
+      m00 = cs;
+      m01 = -sn;
+      m10 = -sn;
+      m11 = -cs;
+      ox = w * 0.5f;
+      oy = h * 0.5f;
+    } else {
+      m00 = w;
+      m01 = 0.0f;
+      m10 = 0.0f;
+      m11 = -h * 0.4f * post_scale_;
+      ox = 0.0f;
+      oy = h * 0.5f;
+      unit_px = -m11;
+    }
+    auto toPixel = [=](const Sample &s) -> Sample {
+      return {ox + m00 * s.x + m01 * s.y, oy + m10 * s.x + m11 * s.y};
     };
 
     const float diag = std::sqrt(w * w + h * h);
     const float ref_energy = 50.0f;
     const float shutter_ratio = 1.0f;
     const float base_gain = (ref_energy * diag) /
-                            (shutter_ratio * samples.size() * kOversampleRate);
-    const float unit_gain = base_gain * beam_gain_ * alpha_mult;
-
-    const int num_samples = static_cast<int>(samples.size());
-    const float half_beam = beam_size_ * 0.5f;
+                            (shutter_ratio * samples.size() *
+                             kQuality.oversample_rate);
 
-    // Per-frame budget to prevent CPU/GPU overload at pathological beta values
-    constexpr int kMaxCirclesPerFrame = 15000;
-    int circles_drawn = 0;
+    BeamSplatter::Params params;
+    params.unit_gain = base_gain * beam_gain_ * alpha_mult;
+    params.base_hue = std::fmod(waveform_hue_ + hue_offset, 360.0f);
+    params.hue_dynamics = hue_dynamics_;
+    params.max_splats = std::max(1, governor_.splatBudget() / share);
 
     // Calculate step_dist ONCE per frame, not per sample
-    // Use original quadratic scaling with a minimum floor
-    float step_dist;
-    if (beta_step_coupled_) {
-      float beta = std::abs(static_cast<float>(testSignal().beta()));
-      // Quadratic formula with higher floor (12px) to ensure full waveform
-      // renders in the chaotic 4-7 zone where Nyquist ringing creates long
-      // segments
-      step_dist = std::max(kMaxDist * (1.0f + 0.2f * beta * beta), 12.0f);
+    if (analytic_beam_) {
+      // Density follows from the beam itself: fs_beam's exp(-4 r^2) profile
+      // over a beam_size_ quad has sigma = beam_size_ / (4 * sqrt(2))
+      params.mode = BeamSplatter::Mode::Analytic;
+      params.beam_sigma = beam_size_ * 0.1767767f;
+    } else if (beta_step_coupled_) {
+      // From the swept segment lengths (see BetaDensity::stepDist)
+      const TestSignalGenerator &gen = testSignal();
+      const BetaDensity density = BetaDensity::lookup(
+          gen.beta(), gen.exponent(), gen.frequency(),
+          audio_player_ ? audio_player_->sampleRate() : 44100.0);
+      params.step_dist = BetaDensity::stepDist(
+          density, unit_px, static_cast<int>(samples.size()),
+          params.max_splats, kQuality.step_dist, beam_size_);
     } else {
-      step_dist = kMaxDist * step_mult_;
-    }
-
-    for (int pos = 0;
-         pos < num_samples - 1 && circles_drawn < kMaxCirclesPerFrame; ++pos) {
-      Sample p1 = toPixel(samples[pos]);
-      Sample p2 = toPixel(samples[pos + 1]);
-
-      float x = p1.x;
-      float y = p1.y;
-      const float dx = p2.x - x;
-      const float dy = p2.y - y;
-      const float d = std::sqrt(dx * dx + dy * dy);
-
-      const int n =
-          std::min(80, std::max(static_cast<int>(std::ceil(d / step_dist)), 1));
-      const float nr = 1.0f / static_cast<float>(n);
-      const float ix = dx * nr;
-      const float iy = dy * nr;
-      const float g = unit_gain * nr;
-      const int end = (pos == num_samples - 2) ? n + 1 : n;
-
-      // Velocity-based hue shift: faster beam motion shifts hue
-      float velocity = d * nr; // Instantaneous velocity per substep
-      float hue_shift =
-          velocity * hue_dynamics_ * 180.0f; // Scale for visible effect
-      float dynamic_hue = std::fmod(waveform_hue_ + hue_shift, 360.0f);
-      if (dynamic_hue < 0.0f)
-        dynamic_hue += 360.0f;
-
-      float brightness = std::min(1.0f, g);
-      visage::Color color = visage::Color::fromAHSV(
-          brightness * 0.9f, dynamic_hue, 0.85f, brightness);
-      canvas.setColor(color);
-
-      for (int k = 0; k < end && circles_drawn < kMaxCirclesPerFrame; ++k) {
-        canvas.fadeCircle(x - half_beam, y - half_beam, beam_size_,
-                          beam_size_ * 0.35f);
-        x += ix;
-        y += iy;
-        ++circles_drawn;
+      params.step_dist = kQuality.step_dist * step_mult_;
+    }
+
+    const double start_us = profiler_ ? Profiler::nowUs() : 0.0;
+    const size_t before = out.size();
+    splatter_.append(samples.data(), static_cast<int>(samples.size()),
+                     toPixel, params, out);
+    if (profiler_) {
+      frame_gen_us_ += Profiler::nowUs() - start_us;
+      frame_splats_ += out.size() - before;
+    }
+  }
+
+  // Submit a splat list as Gaussian beam quads. visage packs every quad of one
+  // shader into a single vertex buffer and draw, so what a splat costs is its
+  // Canvas call, and drawSplats() makes as few as the picture allows: splats
+  // off screen are skipped, and a run of same-hue splats within
+  // kCoalesceReach of each other (a slow or silent beam piling samples on one
+  // spot, phosphor rebuilt from overlapping frames) goes out as one quad at
+  // its intensity-weighted centroid with the run's light, up to full
+  // brightness. The brush only changes when the colour does.
+  void drawSplats(visage::Canvas &canvas, const std::vector<BeamSplat> &splats) {
+    const double start_us = profiler_ ? Profiler::nowUs() : 0.0;
+    const float half_beam = beam_size_ * 0.5f;
+    const float max_x = width() + half_beam;
+    const float max_y = height() + half_beam;
+    const float reach2 = kCoalesceReach * kCoalesceReach;
+    float last_intensity = -1.0f;
+    float last_hue = -1.0f;
+
+    auto submit = [&](const BeamSplat &s) {
+      if (s.intensity != last_intensity || s.hue != last_hue) {
+        // Same as fromAHSV(0.9 * i, hue, 0.85, i): RGB scales with value
+        const float *rgb = hue_rgb_[std::min(static_cast<int>(s.hue),
+                                             BeamSplatter::kHueSteps - 1)];
+        const float i = s.intensity;
+        canvas.setColor(
+            visage::Color(i * 0.9f, rgb[0] * i, rgb[1] * i, rgb[2] * i));
+        last_intensity = s.intensity;
+        last_hue = s.hue;
+      }
+      canvas.shader(&beam_shader_, s.x - half_beam, s.y - half_beam,
+                    beam_size_, beam_size_);
+    };
+
+    BeamSplat run = {0.0f, 0.0f, 0.0f, -1.0f}; // Hue -1: no run yet
+    for (const BeamSplat &s : splats) {
+      if (s.x < -half_beam || s.y < -half_beam || s.x > max_x || s.y > max_y)
+        continue;
+      if (s.hue == run.hue && run.intensity + s.intensity <= 1.0f) {
+        const float dx = s.x - run.x;
+        const float dy = s.y - run.y;
+        if (dx * dx + dy * dy < reach2) {
+          const float total = run.intensity + s.intensity;
+          const float t = total > 0.0f ? s.intensity / total : 0.5f;
+          run.x += dx * t;
+          run.y += dy * t;
+          run.intensity = total;
+          continue;
+        }
+      }
+      if (run.hue >= 0.0f)
+        submit(run);
+      run = s;
+    }
+    if (run.hue >= 0.0f)
+      submit(run);
+
+    if (profiler_)
+      frame_draw_us_ += Profiler::nowUs() - start_us;
+  }
+
+  // Phosphor persistence works like a screen that keeps its light: the trail
+  // (every beam before this frame's) is dimmed by the decay factor once per
+  // frame, the last beam is folded in, and the new beam is drawn over it.
+  // visage keeps no render target between frames to accumulate into, so the
+  // trail stays a splat list and costs a pass over it every frame;
+  // thinPhosphor() holds it to the governor's phosphor budget, a small
+  // fraction of the beam's, which bounds that cost whatever the trail length.
+  // A splat is dropped once it is below kPhosphorFloor of the newest beam's
+  // brightest splat, so a faint (fast) beam leaves as long a trail as a bright
+  // one.
+  void decayPhosphor() {
+    const float floor = kPhosphorFloor * beam_peak_;
+    size_t live = 0;
+    for (BeamSplat &s : phosphor_) {
+      s.intensity *= phosphor_decay_;
+      if (s.intensity >= floor)
+        phosphor_[live++] = s;
+    }
+    phosphor_.resize(live);
+  }
+
+  // Moves the last beam into the trail: dimmed with it, then thinned to budget
+  void foldBeam() {
+    phosphor_.insert(phosphor_.end(), splats_.begin(), splats_.end());
+    decayPhosphor();
+    thinPhosphor();
+  }
+
+  // The reference decayPhosphor() culls against; kept while there is no beam
+  void trackBeamPeak(const std::vector<BeamSplat> &splats) {
+    if (splats.empty())
+      return;
+    float peak = 0.0f;
+    for (const BeamSplat &s : splats)
+      peak = std::max(peak, s.intensity);
+    beam_peak_ = peak;
+  }
+
+  // Over budget: halve the oldest half of the list, whose light is faint by
+  // then. Neighbours within a beam width merge into one splat at their
+  // intensity-weighted centroid, carrying both their light; further apart the
+  // dimmer one is dropped instead, so no light moves by more than the beam is
+  // wide.
+  void thinPhosphor() {
+    const size_t budget = static_cast<size_t>(governor_.phosphorBudget());
+    const float reach2 = beam_size_ * beam_size_;
+    while (phosphor_.size() > budget) {
+      const size_t half = phosphor_.size() / 2;
+      size_t write = 0;
+      size_t read = 0;
+      for (; read + 1 < half; read += 2) {
+        const BeamSplat a = phosphor_[read];
+        const BeamSplat b = phosphor_[read + 1];
+        BeamSplat merged = a.intensity >= b.intensity ? a : b;
+        const float dx = b.x - a.x;
+        const float dy = b.y - a.y;
+        const float sum = a.intensity + b.intensity;
+        if (dx * dx + dy * dy <= reach2 && sum > 0.0f) {
+          merged.x = (a.x * a.intensity + b.x * b.intensity) / sum;
+          merged.y = (a.y * a.intensity + b.y * b.intensity) / sum;
+          merged.intensity = std::min(1.0f, sum);
+        }
+        phosphor_[write++] = merged;
+      }
+      for (; read < phosphor_.size(); ++read)
+        phosphor_[write++] = phosphor_[read];
+      phosphor_.resize(write);
+    }
+  }
+
+  // Rebuild the trail from the stepped history frames (after a step while
+  // frozen) and the beam from the current one. The governor may show fewer of
+  // them.
+  void rebuildPhosphor() {
+    phosphor_.clear();
+    const int frames = std::min(kHistoryFrames, governor_.historyFrames());
+    for (int age = frames - 1; age >= 1; --age) {
+      int idx = (history_index_ - age + kHistoryFrames) % kHistoryFrames;
+      float decay = std::pow(phosphor_decay_, static_cast<float>(age));
+      if (history_[idx].size() >= 2 && decay >= kPhosphorFloor) {
+        generateSplats(history_[idx], decay, splats_);
+        phosphor_.insert(phosphor_.end(), splats_.begin(), splats_.end());
       }
     }
+    thinPhosphor();
+    generateFrameSplats(1.0f, splats_);
+    trackBeamPeak(splats_);
+    rebuild_phosphor_ = false;
   }
 
   void draw(visage::Canvas &canvas) override {
+    const double start_us = Profiler::nowUs();
+    frame_gen_us_ = 0.0;
+    frame_draw_us_ = 0.0;
+    frame_splats_ = 0;
+
     int iw = width();
     int ih = height();
     double time = canvas.time();
+    last_time_ = time;
+
+    if (audio_player_) {
+      const bool step_pending = audio_player_->stepPending();
+      audio_player_->beginFrame();
+      if (step_pending && !audio_player_->stepPending())
+        step(); // A step that waited for the audio thread to freeze landed
+      if (audio_player_->hasAudio())
+        audio_player_->prefetch();
+    }
 
     canvas.setColor(0xff050508);
     canvas.fill(0, 0, iw, ih);
@@ -1496,8 +2653,15 @@ public:
 
       // Only generate new waveform if not paused (freeze display when paused)
       bool is_paused = testSignal().isPaused();
-      if (!is_paused || current_samples_.empty() || needs_step_update_) {
+      samples_generated_ =
+          !is_paused || current_samples_.empty() || needs_step_update_;
+      if (samples_generated_) {
+        // The frame shown so far becomes the one enterIdle() compares with
+        std::swap(current_samples_, idle_samples_[0]);
+        for (int t = 0; t < AudioPlayer::kMaxTraces - 1; ++t)
+          std::swap(trace_samples_[t], idle_samples_[t + 1]);
         generateWaveform(time + time_offset_, current_samples_);
+        generateTraces();
         needs_step_update_ = false;
       }
 
@@ -1506,35 +2670,218 @@ public:
 
         // Always render phosphor trails (frozen snapshot when paused)
         if (phosphor_enabled_) {
-          for (int age = kHistoryFrames - 1; age >= 1; --age) {
-            int idx = (history_index_ - age + kHistoryFrames) % kHistoryFrames;
-            if (history_[idx].size() >= 2) {
-              float decay = std::pow(phosphor_decay_, static_cast<float>(age));
-              if (decay >= 0.02f)
-                renderWaveform(canvas, history_[idx], decay);
-            }
-          }
-          // Only update history when not paused
-          if (!is_paused) {
-            history_[history_index_] = current_samples_;
-            history_index_ = (history_index_ + 1) % kHistoryFrames;
+          if (rebuild_phosphor_) {
+            rebuildPhosphor();
+          } else if (!is_paused || splats_.empty()) {
+            // Only update the trail and beam when not paused
+            foldBeam();
+            generateFrameSplats(1.0f, splats_);
+            trackBeamPeak(splats_);
           }
+          drawSplats(canvas, phosphor_);
+          drawSplats(canvas, splats_);
+        } else {
+          generateFrameSplats(1.0f, splats_);
+          drawSplats(canvas, splats_);
         }
-
-        renderWaveform(canvas, current_samples_, 1.0f);
         canvas.setBlendMode(visage::BlendMode::Alpha);
       }
     }
 
+    finishFrame(start_us);
+    if (!enterIdle(testSignal().isPaused()))
+      redraw();
+  }
+
+  // Stop redrawing once frames stop changing (off for offline renders, which
+  // need every frame drawn)
+  void setIdleEnabled(bool enabled) {
+    idle_enabled_ = enabled;
+    if (!enabled)
+      wake();
+  }
+  bool idle() const { return idle_; }
+
+  // Back to drawing every frame
+  void wake() {
+    idle_static_frames_ = 0;
+    if (!idle_)
+      return;
+    idle_ = false;
+    idle_timer_.stopTimer();
+    last_frame_us_ = 0.0; // The idle gap is not a slow frame to the governor
     redraw();
   }
 
 private:
+  // Idle scheduling. A frame is static when its samples moved less than
+  // kIdleTolerance from the last frame's and nothing else it shows changed;
+  // after kIdleFrames static frames, and once the phosphor from before has
+  // decayed below its floor, draw() stops requesting redraws. The window then
+  // keeps presenting the last composited frame (beam, phosphor, bloom and
+  // post passes all skipped) while a timer polls without rendering: a change
+  // of view or pause state, or new audio that moves, wakes it to full rate.
+  // Paused or silent, this costs a few hundred sample reads per poll.
+  bool enterIdle(bool is_paused) {
+    const uint64_t key = viewKey(is_paused);
+    bool same = key == idle_key_;
+    if (samples_generated_) {
+      same = same && unchanged(current_samples_, idle_samples_[0]);
+      for (int t = 0; t < num_traces_; ++t)
+        same = same && unchanged(trace_samples_[t], idle_samples_[t + 1]);
+    }
+    samples_generated_ = false;
+    idle_key_ = key;
+    idle_static_frames_ = same ? idle_static_frames_ + 1 : 0;
+
+    const int settle =
+        is_paused || !phosphor_enabled_ ? 0 : phosphorSettleFrames();
+    if (!idle_enabled_ || idle_static_frames_ < std::max(kIdleFrames, settle)) {
+      if (idle_)
+        wake(); // Something else redrew an idle frame, and it had news
+      return false;
+    }
+    if (!idle_) {
+      idle_ = true;
+      if (probing())
+        probeMoved(); // Baseline for the polls
+      idle_timer_.startTimer(kIdlePollMs);
+    }
+    return true;
+  }
+
+  void pollIdle() {
+    const bool is_paused = testSignal().isPaused();
+    bool active = viewKey(is_paused) != idle_key_;
+    if (!active)
+      active = probing() ? probeMoved()
+                         : !is_paused; // The demo waveform runs on canvas time
+    if (active)
+      wake();
+  }
+
+  bool probing() const { return audio_player_ && audio_player_->isPlaying(); }
+
+  // Whether samples are within kIdleTolerance of last
+  static bool unchanged(const std::vector<Sample> &samples,
+                        const std::vector<Sample> &last) {
+    bool same = samples.size() == last.size();
+    for (size_t i = 0; same && i < samples.size(); ++i)
+      same = std::abs(samples[i].x - last[i].x) < kIdleTolerance &&
+             std::abs(samples[i].y - last[i].y) < kIdleTolerance;
+    return same;
+  }
+
+  // Whether the newest scope samples moved since the last probe
+  bool probeMoved() {
+    audio_player_->beginFrame();
+    float *left = scratch_left_.data();
+    float *right = scratch_right_.data();
+    audio_player_->getCurrentSamples(left, right, kIdleProbeSamples);
+    bool moved = false;
+    for (int i = 0; i < kIdleProbeSamples; ++i) {
+      Sample &last = idle_probe_[i];
+      moved = moved || std::abs(left[i] - last.x) >= kIdleTolerance ||
+              std::abs(right[i] - last.y) >= kIdleTolerance;
+      last = {left[i], right[i]};
+    }
+    return moved;
+  }
+
+  // Frames until light from before the frames turned static is below the
+  // phosphor floor
+  int phosphorSettleFrames() const {
+    if (phosphor_decay_ <= 0.0f)
+      return 0;
+    if (phosphor_decay_ >= 1.0f)
+      return std::numeric_limits<int>::max();
+    return static_cast<int>(
+        std::ceil(std::log(kPhosphorFloor) / std::log(phosphor_decay_)));
+  }
+
+  // Everything besides the samples that decides what a frame shows
+  uint64_t viewKey(bool is_paused) const {
+    uint64_t key = 14695981039346656037ull; // FNV-1a
+    auto mix = [&key](double v) {
+      uint64_t bits;
+      std::memcpy(&bits, &v, sizeof(bits));
+      key = (key ^ bits) * 1099511628211ull;
+    };
+    for (double v :
+         {static_cast<double>(display_mode_), static_cast<double>(width()),
+          static_cast<double>(height()), timebase_, time_offset_,
+          double{trigger_threshold_}, double{beam_size_}, double{beam_gain_},
+          double{waveform_hue_}, double{hue_dynamics_}, double{slew_},
+          double{step_mult_}, double{phosphor_decay_}, double{post_scale_},
+          double{post_rotate_}, double{crt_intensity_},
+          static_cast<double>(governor_.quality())})
+      mix(v);
+    for (bool b : {is_paused, grid_enabled_, phosphor_enabled_,
+                   beta_step_coupled_, analytic_beam_, rebuild_phosphor_,
+                   needs_step_update_, phosphor_.empty()})
+      mix(b ? 1.0 : 0.0);
+    for (int i = 0; i < PostChain::kNumStages; ++i)
+      mix(post_chain_.get(static_cast<PostChain::Stage>(i)));
+    for (float hue : trace_hue_offset_)
+      mix(hue);
+    mix(num_traces_);
+    return key;
+  }
+
+  // Feeds the frame's timing to the governor and, if set, the profiler
+  void finishFrame(double start_us) {
+    const double end_us = Profiler::nowUs();
+    // An idle frame was drawn on request, not late
+    const double interval_ms = last_frame_us_ > 0.0 && !idle_
+                                   ? (start_us - last_frame_us_) * 0.001
+                                   : 0.0;
+    last_frame_us_ = start_us;
+
+    const double audio_load = audio_player_ ? audio_player_->callbackLoad() : 0.0;
+    if (governor_.update((end_us - start_us) * 0.001, interval_ms, audio_load))
+      qualityChanged();
+
+    if (!profiler_)
+      return;
+    if (interval_ms > 0.0)
+      profiler_->metric(Profiler::kFrameInterval).record(interval_ms);
+    profiler_->metric(Profiler::kFrameCpu).record(end_us - start_us);
+    profiler_->metric(Profiler::kSplatGen).record(frame_gen_us_);
+    profiler_->metric(Profiler::kSplatDraw).record(frame_draw_us_);
+    profiler_->metric(Profiler::kSplats).record(
+        static_cast<double>(frame_splats_));
+    profiler_->metric(Profiler::kQuality).record(100.0 * governor_.quality());
+    profiler_->setSplatBudget(governor_.splatBudget());
+  }
+
+  // Applies the governor's discrete steps
+  void qualityChanged() {
+    updatePostEffect();
+    if (bloom_levels_callback_)
+      bloom_levels_callback_(governor_.bloomLevels());
+  }
+
+  void updatePostEffect() {
+    post_chain_.set(PostChain::kCrt,
+                    governor_.crtBypassed() ? 0.0f : crt_intensity_);
+    setPostEffect(post_chain_.effect());
+  }
+
   std::vector<Sample> current_samples_;
-  std::vector<Sample> history_[kHistoryFrames];
+  std::vector<Sample> trace_samples_[AudioPlayer::kMaxTraces - 1];
+  float trace_hue_offset_[AudioPlayer::kMaxTraces - 1] = {90.0f, 180.0f,
+                                                          270.0f};
+  int trace_window_ = 0; // Samples the main trace read this frame, if any
+  int num_traces_ = 0;   // Extra traces generated this frame
+  std::vector<float> scratch_left_, scratch_right_; // Ring buffer reads
+  std::vector<LevelPyramid::Bucket> levels_;        // Envelope reads
+  std::vector<Sample> history_[kHistoryFrames]; // Trail frames from step()
   int history_index_ = 0;
+  std::vector<BeamSplat> phosphor_; // Trail: earlier beams, decaying
+  bool rebuild_phosphor_ = false;
   bool phosphor_enabled_ = true;
   float phosphor_decay_ = kDefaultPhosphorDecay;
+  float beam_peak_ = 1.0f; // Brightest splat of the newest beam
   float beam_size_ = 3.0f;
   float beam_gain_ = 1.5f;
   float waveform_hue_ = kDefaultWaveformHue;
@@ -1542,7 +2889,9 @@ private:
       kDefaultHueDynamics; // Velocity-based hue shift sensitivity (0-1)
 
   DisplayMode display_mode_ = DisplayMode::XY;
+  double timebase_ = kDefaultTimebase; // Seconds per sweep (time modes)
   double time_offset_ = 0.0;
+  double last_time_ = 0.0; // Canvas time of the last draw (for step())
   float trigger_threshold_ = 0.0f;
   bool trigger_rising_ = true;
   bool waveform_lock_ = true;
@@ -1552,17 +2901,45 @@ private:
   bool test_signal_enabled_ = true; // Enabled by default
 
   AudioPlayer *audio_player_ = nullptr;
+  Profiler *profiler_ = nullptr;
+  double last_frame_us_ = 0.0;
+  double frame_gen_us_ = 0.0;  // Splat generation this frame
+  double frame_draw_us_ = 0.0; // Splat submission this frame
+  size_t frame_splats_ = 0;    // Splats generated this frame
   bool needs_step_update_ = false;
   float post_scale_ = 1.0f;
   float post_rotate_ = 0.0f;
   bool grid_enabled_ = true;
   float crt_intensity_ = kDefaultCrtIntensity;
-  std::unique_ptr<visage::ShaderPostEffect> crt_effect_;
+  PostChain post_chain_;
+  visage::Shader beam_shader_{resources::shaders::vs_shader_quad,
+                              resources::shaders::fs_beam,
+                              visage::BlendMode::Add};
+  QualityGovernor governor_{kQuality};
+  std::function<void(int)> bloom_levels_callback_;
+  WorkerPool splat_pool_{
+      WorkerPool::defaultWorkers(kQuality.max_splat_workers)};
+  BeamSplatter splatter_;
+  std::vector<BeamSplat> splats_; // Reused across frames
+  float hue_rgb_[BeamSplatter::kHueSteps][3]; // Beam colour at full value
   float slew_ = kDefaultSlew;
   float prev_slew_x_ = 0.0f; // Previous filtered X value for slew filter
   float prev_slew_y_ = 0.0f; // Previous filtered Y value for slew filter
   float step_mult_ = kDefaultStepMult; // Rendering step multiplier
   bool beta_step_coupled_ = true; // Couple beta to step distance (default on)
+  bool analytic_beam_ = false;    // Exact line-integral beam segments
+
+  bool idle_enabled_ = true;
+  bool idle_ = false;
+  int idle_static_frames_ = 0;
+  uint64_t idle_key_ = 0;
+  // The previous frame's main and extra trace samples, double-buffered with
+  // current_samples_ and trace_samples_
+  std::vector<Sample> idle_samples_[AudioPlayer::kMaxTraces];
+  bool samples_generated_ = false; // This frame's samples are new
+  std::vector<Sample> idle_probe_ =
+      std::vector<Sample>(kIdleProbeSamples); // Last poll's scope samples
+  CallbackTimer idle_timer_{[this] { pollIdle(); }};
 };
 
 class FavewormEditor;
@@ -1600,7 +2977,9 @@ public:
     addChild(&oscilloscope_);
     oscilloscope_.layout().setMargin(0);
     oscilloscope_.setAudioPlayer(&audio_player_);
+    oscilloscope_.setProfiler(&profiler_);
     audio_player_.setTestGenerator(&oscilloscope_.testSignal());
+    audio_player_.setProfiler(&profiler_);
 
     // Control panel background (added first)
     addChild(&control_panel_);
@@ -1864,14 +3243,21 @@ public:
     beta_step_switch_.setCallback([this](bool v) {
       beta_step_coupled_ = v;
       oscilloscope_.setBetaStepCoupled(v);
-      step_knob_.setEnabled(!v); // Enable Step knob when uncoupled
+      // Enable Step knob when uncoupled
+      step_knob_.setEnabled(!v && !oscilloscope_.analyticBeam());
     });
 
+    // Profiler HUD over the scope, under the help overlay
+    addChild(&profiler_overlay_);
+
     // Help overlay (covers entire window)
     addChild(&help_overlay_);
 
     bloom_.setBloomSize(20.0f);
     bloom_.setBloomIntensity(0.5f); // Slightly higher default glow
+    bloom_.setBloomLevels(oscilloscope_.governor().bloomLevels());
+    oscilloscope_.setBloomLevelsCallback(
+        [this](int levels) { bloom_.setBloomLevels(levels); });
     setPostEffect(&bloom_);
 
     // Initialize oscilloscope parameters to match UI defaults
@@ -2183,6 +3569,9 @@ public:
     // Oscilloscope fills remaining space
     oscilloscope_.setBounds(0, 0, width() - panel_width, height());
 
+    // Profiler HUD in the scope's top-left corner
+    profiler_overlay_.setBounds(10, 10, 420, 186);
+
     // Help overlay covers entire window
     help_overlay_.setBounds(0, 0, width(), height());
   }
@@ -2203,11 +3592,30 @@ public:
     canvas.fill(0, 0, width(), height());
   }
 
+  // Dump the profiler into the working directory (web: JSON to the console)
+  void exportProfile() {
+#if VISAGE_EMSCRIPTEN
+    profiler_.writeJson("/dev/stdout");
+#else
+    if (profiler_.writeCsv("faveworm_profile.csv") &&
+        profiler_.writeJson("faveworm_profile.json"))
+      std::fprintf(stderr, "faveworm: wrote faveworm_profile.csv/.json\n");
+    else
+      std::fprintf(stderr, "faveworm: can't write faveworm_profile.*\n");
+#endif
+  }
+
   bool keyPress(const visage::KeyEvent &event) override {
     if (event.keyCode() == visage::KeyCode::H ||
         (event.isShiftDown() && event.keyCode() == visage::KeyCode::Slash)) {
       help_overlay_.toggle();
       return true;
+    } else if (event.keyCode() == visage::KeyCode::F1) {
+      if (event.isShiftDown())
+        exportProfile();
+      else
+        profiler_overlay_.toggle();
+      return true;
     } else if (event.keyCode() == visage::KeyCode::G) {
       oscilloscope_.setGridEnabled(!oscilloscope_.gridEnabled());
       grid_switch_.setValue(oscilloscope_.gridEnabled());
@@ -2230,6 +3638,26 @@ public:
     } else if (event.keyCode() == visage::KeyCode::F) {
       oscilloscope_.setFilterEnabled(!oscilloscope_.filterEnabled());
       return true;
+    } else if (event.keyCode() == visage::KeyCode::A) {
+      // Toggle analytic beam segments (step controls don't apply there)
+      bool analytic = !oscilloscope_.analyticBeam();
+      oscilloscope_.setAnalyticBeam(analytic);
+      beta_step_switch_.setEnabled(!analytic);
+      step_knob_.setEnabled(!analytic && !beta_step_coupled_);
+      return true;
+    } else if (event.keyCode() == visage::KeyCode::I) {
+      // Live input on/off; Shift+I moves to the next input device
+      if (event.isShiftDown())
+        audio_player_.cycleInputDevice();
+      else
+        audio_player_.setLiveInput(!audio_player_.liveInput());
+      audio_player_.play();
+      return true;
+    } else if (event.keyCode() == visage::KeyCode::O) {
+      // Cycle filter oversampling 1x -> 2x -> 4x
+      int factor = audio_player_.oversampling();
+      audio_player_.setOversampling(factor >= 4 ? 1 : factor * 2);
+      return true;
     } else if (event.keyCode() == visage::KeyCode::W) {
       // Toggle exponent (square mode)
       bool next = !exponent_switch_.value();
@@ -2254,6 +3682,14 @@ public:
             std::max(-1.0f, oscilloscope_.triggerThreshold() - 0.05f));
       }
       return true;
+    } else if (event.keyCode() == visage::KeyCode::Left) {
+      // Shorter timebase
+      oscilloscope_.setTimebase(oscilloscope_.timebase() * 0.5);
+      return true;
+    } else if (event.keyCode() == visage::KeyCode::Right) {
+      // Longer timebase
+      oscilloscope_.setTimebase(oscilloscope_.timebase() * 2.0);
+      return true;
     } else if (event.keyCode() == visage::KeyCode::Comma) {
       // Step back in time
       if (audio_player_.isPaused()) {
@@ -2295,13 +3731,62 @@ public:
 
   void setWindowSize(int w, int h) { setBounds(0, 0, w, h); }
 
+  // Automation by ID: no string lookups, so external control (the WASM
+  // setParameterId export, OSC/MIDI) can run at high rates. The audio thread
+  // glides to each value, so steps do not zipper.
+  void setParam(AudioParam id, float value) {
+    const ParamSpec &spec = kAudioParamSpecs[id];
+    value = std::clamp(value, spec.min, spec.max);
+    switch (id) {
+    case kParamVolume:
+      setVolume(value);
+      break;
+    case kParamCutoff:
+      setFilterCutoff(value);
+      break;
+    case kParamResonance:
+      setFilterResonance(value);
+      break;
+    case kParamPreGain:
+      pre_gain_val_ = value;
+      audio_player_.setPreGain(value);
+      pre_gain_knob_.redraw();
+      break;
+    case kParamLfoFreq:
+      lfo_freq_ = value;
+      oscilloscope_.setLfoFreq(value);
+      lfo_freq_knob_.redraw();
+      break;
+    case kParamLfoDepth:
+      lfo_depth_ = value;
+      oscilloscope_.setLfoDepth(value);
+      lfo_depth_knob_.redraw();
+      break;
+    default:
+      break;
+    }
+  }
+
   void setParam(const std::string &name, float value) {
     if (name == "volume") {
-      setVolume(value);
+      setParam(kParamVolume, value);
     } else if (name == "cutoff") {
-      setFilterCutoff(value);
+      setParam(kParamCutoff, value);
     } else if (name == "resonance") {
-      setFilterResonance(value);
+      setParam(kParamResonance, value);
+    } else if (name == "lfo_freq") {
+      setParam(kParamLfoFreq, value);
+    } else if (name == "lfo_depth") {
+      setParam(kParamLfoDepth, value);
+    } else if (name == "oversampling") {
+      audio_player_.setOversampling(static_cast<int>(value));
+    } else if (name == "live_input") {
+      audio_player_.setLiveInput(value > 0.5f);
+      audio_player_.play();
+    } else if (name == "input_device") {
+      audio_player_.setInputDevice(static_cast<int>(value));
+    } else if (name == "buffer_frames") {
+      audio_player_.setBufferFrames(static_cast<int>(value));
     } else if (name == "freq") {
       signal_freq_ = std::clamp(
           value, static_cast<float>(TestSignalGenerator::kMinFrequency),
@@ -2320,12 +3805,19 @@ public:
     } else if (name == "exponent") {
       audio_player_.setExponent(value > 1.5f ? 2 : 1);
     } else if (name == "pregain") {
-      pre_gain_val_ = std::clamp(value, kMinPreGain, kMaxPreGain);
-      audio_player_.setPreGain(pre_gain_val_);
-      pre_gain_knob_.redraw();
+      setParam(kParamPreGain, value);
     } else if (name == "bloom") {
       bloom_intensity_ = std::clamp(value, 0.0f, 1.25f);
       bloom_.setBloomIntensity(bloom_intensity_);
+      setBloomEnabled(bloom_intensity_ > 0.01f);
+    } else if (name == "glitch") {
+      oscilloscope_.setPostStage(PostChain::kGlitch, value);
+    } else if (name == "warp") {
+      oscilloscope_.setPostStage(PostChain::kWarp, value);
+    } else if (name == "sepia") {
+      oscilloscope_.setPostStage(PostChain::kSepia, value);
+    } else if (name == "grayscale") {
+      oscilloscope_.setPostStage(PostChain::kGrayScale, value);
     } else if (name == "hue") {
       waveform_hue_ = std::clamp(value, 0.0f, 360.0f);
       oscilloscope_.setWaveformHue(waveform_hue_);
@@ -2334,6 +3826,27 @@ public:
       oscilloscope_.setDisplayMode(static_cast<DisplayMode>(m));
       mode_selector_.setIndex(m);
       updatePanelVisibility();
+    } else if (name == "timebase") {
+      oscilloscope_.setTimebase(value);
+    } else if (name == "frame_budget") {
+      oscilloscope_.setFrameBudget(value);
+    } else if (name == "traces") {
+      audio_player_.setNumTraces(static_cast<int>(value));
+    } else if (name.size() > 7 && name.compare(0, 5, "trace") == 0 &&
+               name[6] == '_') {
+      // trace<t>_x, trace<t>_y: file channel (0-based); trace<t>_hue: degrees
+      // from the main hue
+      const int t = name[5] - '0';
+      const std::string field = name.substr(7);
+      const int channel = static_cast<int>(value);
+      if (field == "x")
+        audio_player_.setTraceChannels(t, channel,
+                                       audio_player_.traceChannel(t, true));
+      else if (field == "y")
+        audio_player_.setTraceChannels(
+            t, audio_player_.traceChannel(t, false), channel);
+      else if (field == "hue")
+        oscilloscope_.setTraceHue(t, value);
     }
     redraw();
   }
@@ -2402,6 +3915,8 @@ private:
   SectionFrame signal_box_{"SIGNAL  GEN"};
   SectionFrame filter_box_{"FILTER"};
   SectionFrame display_box_{"DISPLAY"};
+  Profiler profiler_;
+  ProfilerOverlay profiler_overlay_{profiler_};
   HelpOverlay help_overlay_;
   visage::BloomPostEffect bloom_;
 
@@ -2435,6 +3950,284 @@ private:
   FadeOutTimer fade_out_timer_{this, [this] { visage::closeApplication(); }};
 };
 
+#if !VISAGE_EMSCRIPTEN
+// Headless renderer: plays a file through the same DSP chain and oscilloscope
+// pipeline into an offscreen target at a fixed frame rate, as fast as the GPU
+// allows. The DSP runs on its own thread a few frames ahead of rendering and
+// finished frames go to encoder threads, so the render loop only draws.
+class OfflineRenderer : public visage::ApplicationWindow {
+public:
+  struct Options {
+    std::string input;
+    std::string output = "-"; // "-" = raw RGBA to stdout, *.rgba = raw file,
+                              // else a PNG pattern with one %d
+    int width = 1920;
+    int height = 1080;
+    double fps = 60.0;
+    DisplayMode mode = DisplayMode::XY;
+    float bloom = kDefaultBloomIntensity;
+    float crt = kDefaultCrtIntensity;
+    int threads = 0; // PNG encoders; 0 = hardware concurrency
+  };
+
+  static constexpr int kLeadFrames = 4; // DSP may run up to this far ahead
+
+  explicit OfflineRenderer(Options options) : options_(std::move(options)) {
+    addChild(&oscilloscope_);
+    oscilloscope_.setAudioPlayer(&audio_player_);
+    audio_player_.setTestGenerator(&oscilloscope_.testSignal());
+
+    oscilloscope_.setDisplayMode(options_.mode);
+    oscilloscope_.setHueDynamics(kDefaultHueDynamics);
+    oscilloscope_.setPhosphorDecay(kDefaultPhosphorDecay);
+    oscilloscope_.setSlew(kDefaultSlew);
+    oscilloscope_.setStepMult(kDefaultStepMult);
+    oscilloscope_.setCrtIntensity(options_.crt);
+    oscilloscope_.setFrameBudget(0.0); // Every frame at full quality
+    oscilloscope_.setIdleEnabled(false);
+
+    bloom_.setBloomSize(20.0f);
+    bloom_.setBloomIntensity(options_.bloom);
+    setPostEffect(options_.bloom > 0.01f ? &bloom_ : nullptr);
+  }
+
+  ~OfflineRenderer() {
+    if (raw_file_ && raw_file_ != stdout)
+      std::fclose(raw_file_);
+    else if (raw_file_)
+      std::fflush(raw_file_);
+  }
+
+  void resized() override { oscilloscope_.setBounds(0, 0, width(), height()); }
+
+  int run() {
+    if (!audio_player_.load(options_.input)) {
+      std::fprintf(stderr, "faveworm: can't read %s\n",
+                   options_.input.c_str());
+      return 1;
+    }
+    audio_player_.startOffline();
+
+    std::unique_ptr<FrameSink> sink = makeSink();
+    if (!sink)
+      return 1;
+
+    const double sr = audio_player_.sampleRate();
+    const int total =
+        static_cast<int>(std::ceil(audio_player_.duration() * options_.fps));
+
+    // Samples the DSP thread runs ahead of the frame drawn, plus that frame,
+    // have to stay in the scope history or its window reads blank
+    const int lead = std::min(
+        kLeadFrames,
+        static_cast<int>(audio_player_.historyFrames() * options_.fps / sr) -
+            1);
+    if (lead < 1) {
+      std::fprintf(stderr,
+                   "faveworm: --fps must be at least %.1f at %.0f Hz\n",
+                   std::ceil(20.0 * sr / audio_player_.historyFrames()) / 10.0,
+                   sr);
+      return 1;
+    }
+
+    // DSP thread: frame k covers samples up to round((k + 1) * sr / fps)
+    AudioPlayer::OfflineFrame frames[kLeadFrames];
+    std::mutex mutex;
+    std::condition_variable cv;
+    int ready = 0, consumed = 0;
+    bool cancelled = false;
+    std::thread dsp([&] {
+      size_t done = 0;
+      for (int k = 0; k < total; ++k) {
+        size_t end = static_cast<size_t>(std::llround((k + 1) * sr /
+                                                      options_.fps));
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv.wait(lock, [&] { return k - consumed < lead || cancelled; });
+          if (cancelled)
+            return;
+        }
+        AudioPlayer::OfflineFrame frame =
+            audio_player_.renderOffline(static_cast<int>(end - done));
+        done = end;
+        std::lock_guard<std::mutex> lock(mutex);
+        frames[k % lead] = frame;
+        ready = k + 1;
+        cv.notify_all();
+      }
+    });
+
+    setBounds(0, 0, options_.width, options_.height);
+    auto start = std::chrono::steady_clock::now();
+    bool ok = true;
+    for (int k = 0; k < total && ok; ++k) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return ready > k; });
+        audio_player_.latchFrame(frames[k % lead]);
+        consumed = k + 1;
+      }
+      cv.notify_all();
+
+      drawWindowless(options_.width, options_.height);
+      const visage::Screenshot &shot = takeScreenshot();
+      ok = sink->submit(k, shot.data(), shot.width(), shot.height());
+
+      if (k % static_cast<int>(options_.fps) == 0 || k + 1 == total)
+        reportProgress(k + 1, total, start);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      cancelled = true;
+    }
+    cv.notify_all();
+    dsp.join();
+    ok = sink->finish() && ok;
+    std::fprintf(stderr, "\n");
+    if (!ok)
+      std::fprintf(stderr, "faveworm: writing %s failed\n",
+                   options_.output.c_str());
+    return ok ? 0 : 1;
+  }
+
+private:
+  static bool endsWith(const std::string &s, const char *suffix) {
+    size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+  }
+
+  // Whether pattern holds exactly one integer conversion (%d, optionally
+  // zero-padded to a width, as in frame_%05d.png) and otherwise only literal
+  // text and %%, so it is safe to hand to snprintf
+  static bool isFramePattern(const std::string &pattern) {
+    int conversions = 0;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+      if (pattern[i] != '%')
+        continue;
+      if (++i < pattern.size() && pattern[i] == '%')
+        continue;
+      if (i < pattern.size() && pattern[i] == '0')
+        ++i;
+      const size_t width = i;
+      while (i < pattern.size() &&
+             std::isdigit(static_cast<unsigned char>(pattern[i])))
+        ++i;
+      if (i - width > 2 || i >= pattern.size() || pattern[i] != 'd')
+        return false;
+      ++conversions;
+    }
+    return conversions == 1;
+  }
+
+  // Raw output is one ordered stream; PNG frames are encoded in parallel
+  std::unique_ptr<FrameSink> makeSink() {
+    const std::string &out = options_.output;
+    if (out == "-" || endsWith(out, ".rgba") || endsWith(out, ".raw")) {
+      if (out == "-") {
+#if defined(_WIN32)
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        raw_file_ = stdout;
+      } else {
+        raw_file_ = std::fopen(out.c_str(), "wb");
+      }
+      if (!raw_file_) {
+        std::fprintf(stderr, "faveworm: can't write %s\n", out.c_str());
+        return nullptr;
+      }
+      FILE *file = raw_file_;
+      return std::make_unique<FrameSink>(
+          [file](int, const uint8_t *rgba, int w, int h) {
+            size_t bytes = static_cast<size_t>(w) * h * 4;
+            return std::fwrite(rgba, 1, bytes, file) == bytes;
+          },
+          1, true);
+    }
+
+    if (!isFramePattern(out)) {
+      std::fprintf(stderr,
+                   "faveworm: -o %s needs exactly one %%d for the frame "
+                   "number (e.g. frame_%%05d.png), or - or a .rgba file\n",
+                   out.c_str());
+      return nullptr;
+    }
+
+    int threads = options_.threads > 0
+                      ? options_.threads
+                      : static_cast<int>(std::thread::hardware_concurrency());
+    return std::make_unique<FrameSink>(
+        [out](int index, const uint8_t *rgba, int w, int h) {
+          char path[1024];
+          const int n = std::snprintf(path, sizeof(path), out.c_str(), index);
+          if (n < 0 || n >= static_cast<int>(sizeof(path)))
+            return false;
+          return stbi_write_png(path, w, h, 4, rgba, w * 4) != 0;
+        },
+        std::max(1, threads - 1), false);
+  }
+
+  void reportProgress(int frame, int total,
+                      std::chrono::steady_clock::time_point start) const {
+    double elapsed = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    double speed = elapsed > 0.0 ? frame / options_.fps / elapsed : 0.0;
+    std::fprintf(stderr, "\rframe %d/%d  %.1fx real time", frame, total,
+                 speed);
+  }
+
+  Options options_;
+  AudioPlayer audio_player_;
+  Oscilloscope oscilloscope_;
+  visage::BloomPostEffect bloom_;
+  FILE *raw_file_ = nullptr;
+};
+
+// faveworm --render <input> [-o <output>] [--fps N] [--size WxH]
+//          [--mode xy|trigger|free] [--bloom X] [--crt X] [--threads N]
+int renderFaveworm(int argc, char **argv) {
+  OfflineRenderer::Options options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (arg == "--render" && value) {
+      options.input = argv[++i];
+    } else if ((arg == "-o" || arg == "--output") && value) {
+      options.output = argv[++i];
+    } else if (arg == "--fps" && value) {
+      options.fps = std::clamp(std::atof(argv[++i]), 1.0, 1000.0);
+    } else if (arg == "--size" && value) {
+      std::sscanf(argv[++i], "%dx%d", &options.width, &options.height);
+    } else if (arg == "--mode" && value) {
+      std::string mode = argv[++i];
+      options.mode = mode == "trigger" ? DisplayMode::TimeTrigger
+                     : mode == "free"  ? DisplayMode::TimeFree
+                                       : DisplayMode::XY;
+    } else if (arg == "--bloom" && value) {
+      options.bloom = static_cast<float>(std::atof(argv[++i]));
+    } else if (arg == "--crt" && value) {
+      options.crt = static_cast<float>(std::atof(argv[++i]));
+    } else if (arg == "--threads" && value) {
+      options.threads = std::atoi(argv[++i]);
+    } else {
+      std::fprintf(stderr, "faveworm: unknown option %s\n", arg.c_str());
+      return 2;
+    }
+  }
+  if (options.input.empty() || options.width <= 0 || options.height <= 0) {
+    std::fprintf(stderr,
+                 "usage: faveworm --render <input> [-o <output>] [--fps N] "
+                 "[--size WxH] [--mode xy|trigger|free] [--bloom X] "
+                 "[--crt X] [--threads N]\n");
+    return 2;
+  }
+
+  OfflineRenderer renderer(options);
+  return renderer.run();
+}
+#endif
+
 int runFaveworm() {
   FavewormEditor editor;
   editor.setWindowDecoration(visage::Window::Decoration::Client);
@@ -2469,6 +4262,14 @@ void setParameter(const char *name, float value) {
     g_editor->setParam(name, value);
 }
 
+// id is an AudioParam (0 volume, 1 cutoff, 2 resonance, 3 pregain, 4 lfo_freq,
+// 5 lfo_depth)
+EMSCRIPTEN_KEEPALIVE
+void setParameterId(int id, float value) {
+  if (g_editor && id >= 0 && id < kNumAudioParams)
+    g_editor->setParam(static_cast<AudioParam>(id), value);
+}
+
 EMSCRIPTEN_KEEPALIVE
 void resizeWindow(int w, int h) {
   if (g_editor)
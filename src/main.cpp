@@ -19,13 +19,33 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <cstring>
+
 int runFaveworm();
+#if !VISAGE_EMSCRIPTEN
+int renderFaveworm(int argc, char **argv);
+#endif
+
+// "--render" switches to the headless renderer
+static int run(int argc, char **argv) {
+#if !VISAGE_EMSCRIPTEN
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--render") == 0)
+      return renderFaveworm(argc, argv);
+  }
+#else
+  (void)argc;
+  (void)argv;
+#endif
+  return runFaveworm();
+}
 
 #if VISAGE_WINDOWS
 #include <windows.h>
+#include <stdlib.h>
 int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int) {
-  return runFaveworm();
+  return run(__argc, __argv);
 }
 #else
-int main(int, char **) { return runFaveworm(); }
+int main(int argc, char **argv) { return run(argc, argv); }
 #endif
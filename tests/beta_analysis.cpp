@@ -1,11 +1,21 @@
 // Quick test to analyze waveform characteristics at different beta values
-// Compile: clang++ -std=c++17 -I../src tests/beta_analysis.cpp -o beta_analysis
+// Compile: clang++ -std=c++17 -O2 -pthread -I../src tests/beta_analysis.cpp -o beta_analysis
+//
+// beta_analysis --sweep src/BetaDensityTable.h regenerates the render density
+// table (see src/BetaDensity.h) from a sweep over beta, exponent, frequency
+// and detune, spread over all cores. Rerun it when the RPM oscillator changes.
 
 #include "../src/TestSignalGenerator.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <thread>
 #include <vector>
 
 struct WaveStats {
@@ -134,7 +144,208 @@ void writeWavFile(const char *filename, double beta, int num_samples = 44100) {
   std::cout << "Wrote: " << filename << std::endl;
 }
 
-int main() {
+// Sweep grid. Beta and exponent cover the generator's whole range; frequency
+// is log spaced; detune is folded into each cell as the worst case.
+constexpr double kSweepRate = 44100.0;
+constexpr int kSweepExponents = 2;
+constexpr int kSweepBetas = 61; // -10 to 50 in steps of 1
+constexpr double kSweepMinBeta = -10.0;
+constexpr double kSweepBetaStep = 1.0;
+constexpr int kSweepFrequencies = 8; // 10 to 500 Hz
+constexpr double kSweepDetunes[] = {0.9, 0.95, 1.0, 1.003, 1.05, 1.1};
+constexpr int kSweepWarmup = 4096;  // Let chaotic orbits settle first
+constexpr int kSweepSamples = 16384;
+
+double sweepFrequency(int f) {
+  return TestSignalGenerator::kMinFrequency *
+         std::pow(TestSignalGenerator::kMaxFrequency /
+                      TestSignalGenerator::kMinFrequency,
+                  static_cast<double>(f) / (kSweepFrequencies - 1));
+}
+
+// XY segment lengths of one cell, in signal units per sample
+// chaos is 0 for a clean orbit and approaches 1 as the path turns to noise:
+// the larger of the share of the path in jumps (segments over 4x the median,
+// the intermittent zone) and how far the mean outgrows the beta 0 orbit's at
+// the same frequency and detune (fully chaotic, where every segment is long).
+struct SegmentStats {
+  float mean = 0.0f;
+  float p99 = 0.0f;
+  float chaos = 0.0f;
+};
+
+SegmentStats measureSegments(double beta, int exponent, double freq,
+                             double detune) {
+  TestSignalGenerator gen;
+  gen.setSampleRate(kSweepRate);
+  gen.setFrequency(freq);
+  gen.setDetune(detune);
+  gen.setBeta(beta);
+  gen.setExponent(exponent);
+
+  std::vector<float> left(kSweepWarmup + kSweepSamples);
+  std::vector<float> right(left.size());
+  gen.generate(left.data(), right.data(), static_cast<int>(left.size()));
+
+  std::vector<float> dist;
+  dist.reserve(kSweepSamples);
+  for (int i = kSweepWarmup + 1; i < static_cast<int>(left.size()); ++i) {
+    float dx = left[i] - left[i - 1];
+    float dy = right[i] - right[i - 1];
+    float d = std::sqrt(dx * dx + dy * dy);
+    dist.push_back(std::isfinite(d) ? d : 0.0f);
+  }
+
+  SegmentStats stats;
+  double sum = 0.0;
+  for (float d : dist)
+    sum += d;
+  stats.mean = static_cast<float>(sum / dist.size());
+
+  std::vector<float> sorted = dist;
+  std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2,
+                   sorted.end());
+  const float median = sorted[sorted.size() / 2];
+  const size_t p99 = sorted.size() * 99 / 100;
+  std::nth_element(sorted.begin(), sorted.begin() + p99, sorted.end());
+  stats.p99 = sorted[p99];
+
+  double jumps = 0.0;
+  for (float d : dist)
+    if (d > 4.0f * median)
+      jumps += d;
+  stats.chaos = sum > 0.0 ? static_cast<float>(jumps / sum) : 0.0f;
+  return stats;
+}
+
+constexpr int kSweepNumDetunes = sizeof(kSweepDetunes) / sizeof(double);
+
+// Worst case over detune: the most path, the longest jumps. clean holds the
+// beta 0 means per frequency and detune.
+SegmentStats measureCell(int e, int b, int f, const float *clean) {
+  SegmentStats cell;
+  for (int d = 0; d < kSweepNumDetunes; ++d) {
+    SegmentStats s = measureSegments(kSweepMinBeta + b * kSweepBetaStep, e + 1,
+                                     sweepFrequency(f), kSweepDetunes[d]);
+    const float growth =
+        s.mean > 0.0f ? 1.0f - clean[f * kSweepNumDetunes + d] / s.mean : 0.0f;
+    s.chaos = std::max(s.chaos, growth);
+    cell.mean = std::max(cell.mean, s.mean);
+    cell.p99 = std::max(cell.p99, s.p99);
+    cell.chaos = std::max(cell.chaos, s.chaos);
+  }
+  return cell;
+}
+
+// A float as a C++ literal (4 significant digits)
+std::string floatLiteral(float v) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.4g", v);
+  std::string s = buf;
+  if (s.find_first_of(".e") == std::string::npos)
+    s += ".0";
+  return s + "f";
+}
+
+int runSweep(const char *header_path) {
+  const int num_cells = kSweepExponents * kSweepBetas * kSweepFrequencies;
+  std::vector<SegmentStats> cells(num_cells);
+  std::vector<float> clean(kSweepFrequencies * kSweepNumDetunes);
+
+  // Items are independent: workers take the next one until none are left
+  const int num_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  auto parallelFor = [num_threads](int count, auto &&fn) {
+    std::atomic<int> next{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+      threads.emplace_back([&] {
+        for (int i = next++; i < count; i = next++)
+          fn(i);
+      });
+    for (std::thread &t : threads)
+      t.join();
+  };
+
+  parallelFor(static_cast<int>(clean.size()), [&](int i) {
+    clean[i] = measureSegments(0.0, 1, sweepFrequency(i / kSweepNumDetunes),
+                               kSweepDetunes[i % kSweepNumDetunes])
+                   .mean;
+  });
+  parallelFor(num_cells, [&](int c) {
+    int f = c % kSweepFrequencies;
+    int b = c / kSweepFrequencies % kSweepBetas;
+    int e = c / (kSweepFrequencies * kSweepBetas);
+    cells[c] = measureCell(e, b, f, clean.data());
+  });
+
+  std::ofstream out(header_path);
+  if (!out) {
+    std::cerr << "Cannot write " << header_path << "\n";
+    return 1;
+  }
+  out << "#pragma once\n\n"
+      << "// Generated by tests/beta_analysis.cpp (--sweep); do not edit.\n"
+      << "// TestSignalGenerator XY segment lengths at " << kSweepRate
+      << " Hz per exponent, beta\n"
+      << "// and frequency, worst case over detune: {mean, p99, chaos}. See\n"
+      << "// BetaDensity.h.\n"
+      << "struct BetaDensityTable {\n"
+      << "  static constexpr double kSampleRate = " << kSweepRate << ";\n"
+      << "  static constexpr int kExponents = " << kSweepExponents << ";\n"
+      << "  static constexpr int kBetas = " << kSweepBetas << ";\n"
+      << "  static constexpr double kMinBeta = " << kSweepMinBeta << ";\n"
+      << "  static constexpr double kBetaStep = " << kSweepBetaStep << ";\n"
+      << "  static constexpr int kFrequencies = " << kSweepFrequencies << ";\n"
+      << "  static constexpr double kMinFrequency = "
+      << TestSignalGenerator::kMinFrequency << ";\n"
+      << "  static constexpr double kMaxFrequency = "
+      << TestSignalGenerator::kMaxFrequency << ";\n\n"
+      << "  static constexpr float kCells[kExponents][kBetas][kFrequencies][3] "
+         "= {\n";
+  for (int e = 0; e < kSweepExponents; ++e) {
+    out << "    {\n";
+    for (int b = 0; b < kSweepBetas; ++b) {
+      out << "      // beta " << kSweepMinBeta + b * kSweepBetaStep << "\n"
+          << "      {";
+      for (int f = 0; f < kSweepFrequencies; ++f) {
+        const SegmentStats &s =
+            cells[(e * kSweepBetas + b) * kSweepFrequencies + f];
+        out << (f == 0 ? "" : f % 2 ? ", " : ",\n       ") << "{"
+            << floatLiteral(s.mean) << ", " << floatLiteral(s.p99) << ", "
+            << floatLiteral(s.chaos) << "}";
+      }
+      out << "},\n";
+    }
+    out << "    },\n";
+  }
+  out << "  };\n};\n";
+
+  // Chaos at the default 80 Hz, to eyeball where the stable zones end
+  std::cout << std::fixed << std::setprecision(4);
+  std::cout << "Swept " << num_cells << " cells on " << num_threads
+            << " threads into " << header_path << "\n\n";
+  std::cout << std::setw(6) << "Beta" << std::setw(10) << "Exp" << std::setw(12)
+            << "Mean" << std::setw(12) << "P99" << std::setw(10) << "Chaos"
+            << "\n";
+  const int f80 = static_cast<int>(std::lround(
+      (kSweepFrequencies - 1) * std::log(80.0 / 10.0) / std::log(50.0)));
+  for (int e = 0; e < kSweepExponents; ++e) {
+    for (int b = 0; b < kSweepBetas; b += 2) {
+      const SegmentStats &s =
+          cells[(e * kSweepBetas + b) * kSweepFrequencies + f80];
+      std::cout << std::setw(6) << kSweepMinBeta + b * kSweepBetaStep
+                << std::setw(10) << e + 1 << std::setw(12) << s.mean
+                << std::setw(12) << s.p99 << std::setw(10) << s.chaos << "\n";
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 2 && std::strcmp(argv[1], "--sweep") == 0)
+    return runSweep(argv[2]);
+
   std::cout << std::fixed << std::setprecision(4);
   std::cout << "Beta Analysis - RPM Oscillator Waveform Characteristics\n";
   std::cout << "========================================================\n\n";
@@ -0,0 +1,460 @@
+// Headless benchmarks for the DSP and beam hot paths
+// Build: cmake -S . -B build -DFAVEWORM_BUILD_APP=OFF && cmake --build build
+//        --target faveworm_bench
+// Run:   faveworm_bench [--quick] > results.json
+//
+// Each case is timed as the best of several runs of at least ~50 ms and
+// reported as nanoseconds per item. The table goes to stderr and a JSON
+// document to stdout, so results can be diffed between builds.
+
+#include "AudioData.h"
+#include "BeamSplatter.h"
+#include "BetaDensity.h"
+#include "FilterMorpher.h"
+#include "QualityGovernor.h"
+#include "ScopeChain.h"
+#include "ScopeChannel.h"
+#include "TestSignalGenerator.h"
+#include "WorkerPool.h"
+#include "dsp/dfl_Resampler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Result {
+  std::string name;
+  std::string unit;
+  double ns_per_item;
+  double extra; // Case-specific figure (e.g. splats per frame), or -1
+  std::string extra_name;
+};
+
+std::vector<Result> g_results;
+int g_repeats = 5;
+double g_min_seconds = 0.05;
+volatile float g_sink = 0.0f; // Keeps results alive
+
+double seconds() {
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// run(iterations) does the work and returns how many items it processed
+void bench(const std::string &name, const std::string &unit,
+           const std::function<long(long)> &run, double extra = -1.0,
+           const std::string &extra_name = "") {
+  long iterations = 1;
+  for (;;) { // Calibrate: grow until one run takes long enough
+    double start = seconds();
+    run(iterations);
+    if (seconds() - start >= g_min_seconds || iterations >= (1L << 30))
+      break;
+    iterations *= 2;
+  }
+
+  double best = 1e30;
+  for (int r = 0; r < g_repeats; ++r) {
+    double start = seconds();
+    long items = run(iterations);
+    best = std::min(best, (seconds() - start) * 1e9 / items);
+  }
+
+  g_results.push_back({name, unit, best, extra, extra_name});
+  std::fprintf(stderr, "%-34s %12.2f ns/%s", name.c_str(), best, unit.c_str());
+  if (extra >= 0.0)
+    std::fprintf(stderr, "   %.0f %s", extra, extra_name.c_str());
+  std::fprintf(stderr, "\n");
+}
+
+// Filters ---------------------------------------------------------------
+
+constexpr int kBlock = ScopeChain::kMaxFrames; // AudioPlayer::kControlBlock
+
+std::vector<float> noise(int n) {
+  std::vector<float> x(n);
+  uint32_t seed = 1;
+  for (float &v : x) {
+    seed = seed * 1664525u + 1013904223u;
+    v = static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+  }
+  return x;
+}
+
+void benchFilters() {
+  const int n = 4096;
+  std::vector<float> in = noise(n);
+  std::vector<float> lp(n), bp(n), hp(n), x(n), y(n);
+
+  SimpleSVF svf;
+  svf.setSampleRate(48000.0);
+  svf.setCutoff(400.0);
+  svf.setResonance(0.9);
+  bench("svf_process_sample", "sample", [&](long iters) {
+    double acc = 0.0;
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; ++i)
+        acc += svf.process(in[i]).lp;
+    g_sink = static_cast<float>(acc);
+    return iters * n;
+  });
+  bench("svf_process_block", "sample", [&](long iters) {
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; i += kBlock)
+        svf.processBlock(&in[i], &lp[i], &bp[i], &hp[i], kBlock);
+    g_sink = lp[n - 1];
+    return iters * n;
+  });
+
+  for (int factor : {2, 4}) {
+    OversampledSVF os;
+    os.setSampleRate(48000.0);
+    os.setOversampling(factor);
+    os.setCutoff(400.0);
+    os.setResonance(0.9);
+    bench("svf_block_os" + std::to_string(factor), "sample", [&](long iters) {
+      for (long it = 0; it < iters; ++it)
+        for (int i = 0; i < n; i += kBlock)
+          os.processBlock(&in[i], &lp[i], &bp[i], &hp[i], kBlock);
+      g_sink = lp[n - 1];
+      return iters * n;
+    });
+  }
+
+  FilterMorpher morpher;
+  morpher.setPosition(0.4f, 0.3f);
+  morpher.setSplitAngle(30.0f);
+  morpher.setSplitDepth(0.5f);
+  bench("morpher_apply_xy_sample", "sample", [&](long iters) {
+    double acc = 0.0;
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; ++i) {
+        auto o = morpher.applyXY(lp[i], bp[i], hp[i]);
+        acc += o.x + o.y;
+      }
+    g_sink = static_cast<float>(acc);
+    return iters * n;
+  });
+  bench("morpher_apply_xy_block", "sample", [&](long iters) {
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; i += kBlock)
+        morpher.applyXYBlock(&lp[i], &bp[i], &hp[i], &x[i], &y[i], kBlock);
+    g_sink = x[n - 1];
+    return iters * n;
+  });
+}
+
+// Oscillators -----------------------------------------------------------
+
+void benchOscillators() {
+  const int n = 4096;
+
+  for (dfl::SineCore core : {dfl::SineCore::Precise, dfl::SineCore::Fast}) {
+    const std::string suffix = core == dfl::SineCore::Fast ? "_fast" : "";
+
+    dfl::RPMOscillator osc;
+    osc.setSampleRate(48000.0);
+    osc.setFrequency(80.0);
+    osc.setBeta(2.0);
+    osc.setSineCore(core);
+    bench("rpm_get_sample" + suffix, "sample", [&](long iters) {
+      double acc = 0.0;
+      for (long it = 0; it < iters; ++it)
+        for (int i = 0; i < n; ++i)
+          acc += osc.getSample();
+      g_sink = static_cast<float>(acc);
+      return iters * n;
+    });
+
+    TestSignalGenerator gen;
+    gen.setSampleRate(48000.0);
+    gen.setFrequency(80.0);
+    gen.setDetune(1.003);
+    gen.setBeta(2.0);
+    gen.setSineCore(core);
+    std::vector<float> l(n), r(n);
+    bench("test_signal_generate" + suffix, "frame", [&](long iters) {
+      for (long it = 0; it < iters; ++it)
+        gen.generate(l.data(), r.data(), n);
+      g_sink = l[n - 1];
+      return iters * n;
+    });
+  }
+
+  const dfl::SineLUT &lut = dfl::getSineLUT();
+  bench("sine_lut", "call", [&](long iters) {
+    double acc = 0.0, phase = 0.0;
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; ++i) {
+        acc += lut(phase);
+        phase += 0.0137;
+      }
+    g_sink = static_cast<float>(acc);
+    return iters * n;
+  });
+  bench("fast_sine_table", "call", [&](long iters) {
+    float acc = 0.0f;
+    uint32_t phase = 0;
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; ++i) {
+        acc += dfl::FastSineTable::lookup(phase);
+        phase += 58841051u; // 0.0137 cycles, as sine_lut
+      }
+    g_sink = acc;
+    return iters * n;
+  });
+  bench("std_sin", "call", [&](long iters) {
+    double acc = 0.0, phase = 0.0;
+    for (long it = 0; it < iters; ++it)
+      for (int i = 0; i < n; ++i) {
+        acc += std::sin(phase);
+        phase += 0.0137;
+      }
+    g_sink = static_cast<float>(acc);
+    return iters * n;
+  });
+}
+
+// Audio callback --------------------------------------------------------
+
+// AudioPlayer::processBlock per control block: the input (test signal, or
+// the file resampled to the stream rate), the SVF's cutoff ramp, then the
+// ScopeChain the callback runs (mono mix, oversampled SVF, morpher, level
+// trigger, scope channel and the gain-ramped interleaved output).
+void benchAudioProcess(const std::string &name, int oversampling,
+                       bool resample) {
+  const int buffer = 512; // AudioPlayer::kOutputBufferFrames
+  TestSignalGenerator gen;
+  gen.setSampleRate(48000.0);
+  gen.setFrequency(80.0);
+  gen.setBeta(2.0);
+  OversampledSVF svf;
+  svf.setSampleRate(48000.0);
+  svf.setOversampling(oversampling);
+  svf.setResonance(0.9);
+  FilterMorpher morpher;
+  morpher.setPosition(0.4f, 0.3f);
+  dfl::Resampler resampler;
+  resampler.setRates(44100.0, 48000.0);
+  ScopeChannel channel(ScopeChannel::capacityFor(48000));
+  ScopeChain chain(svf, morpher, channel);
+  std::vector<float> out(2 * buffer);
+
+  ScopeChain::Block block;
+  block.target_gain = 1.0f;
+  block.ramp_inc = 1.0f / 2400.0f; // 50 ms at 48 kHz
+
+  bench(name, "frame", [&](long iters) {
+    for (long it = 0; it < iters; ++it) {
+      for (int done = 0; done < buffer; done += kBlock) {
+        float in_l[kBlock], in_r[kBlock];
+        if (resample)
+          resampler.process(in_l, in_r, kBlock, [&](float *l, float *r,
+                                                    int count) {
+            gen.generate(l, r, count);
+          });
+        else
+          gen.generate(in_l, in_r, kBlock);
+
+        block.in_l = in_l;
+        block.in_r = in_r;
+        block.num_frames = kBlock;
+        svf.rampCutoff(400.0, kBlock);
+        chain.process(block, &out[2 * done]);
+      }
+      channel.publish(buffer, chain.triggerPos(), 0.0);
+    }
+    g_sink = out[0];
+    return iters * buffer;
+  });
+}
+
+// Files -----------------------------------------------------------------
+
+bool writeWav(const std::string &path, int seconds) {
+  const int rate = 48000;
+  const uint32_t frames = static_cast<uint32_t>(rate) * seconds;
+  const uint32_t data_size = frames * 4;
+  std::ofstream f(path, std::ios::binary);
+  if (!f)
+    return false;
+  auto u32 = [&](uint32_t v) { f.write(reinterpret_cast<char *>(&v), 4); };
+  auto u16 = [&](uint16_t v) { f.write(reinterpret_cast<char *>(&v), 2); };
+  f.write("RIFF", 4);
+  u32(36 + data_size);
+  f.write("WAVEfmt ", 8);
+  u32(16);
+  u16(1); // PCM
+  u16(2);
+  u32(rate);
+  u32(rate * 4);
+  u16(4);
+  u16(16);
+  f.write("data", 4);
+  u32(data_size);
+
+  std::vector<int16_t> chunk(2 * rate);
+  for (int s = 0; s < seconds; ++s) {
+    for (int i = 0; i < rate; ++i)
+      chunk[2 * i] = chunk[2 * i + 1] =
+          static_cast<int16_t>(10000.0 * std::sin(i * 0.01));
+    f.write(reinterpret_cast<char *>(chunk.data()), chunk.size() * 2);
+  }
+  return static_cast<bool>(f);
+}
+
+void benchAudioData(int seconds) {
+  // In the temp directory, not the working one: the file is large
+  std::error_code ec;
+  const std::string path =
+      (std::filesystem::temp_directory_path(ec) / "faveworm_bench.wav")
+          .string();
+  if (!writeWav(path, seconds)) {
+    std::fprintf(stderr, "faveworm_bench: can't write %s\n", path.c_str());
+    std::remove(path.c_str());
+    return;
+  }
+
+  AudioData audio;
+  double start = ::seconds();
+  bool ok = audio.load(path);
+  const double load_ns = (::seconds() - start) * 1e9;
+  if (ok) {
+    const double frames = static_cast<double>(audio.numFrames());
+    g_results.push_back(
+        {"audio_data_load", "file", load_ns, frames, "frames"});
+    std::fprintf(stderr, "%-34s %12.0f ns/file   %.0f frames\n",
+                 "audio_data_load", load_ns, frames);
+
+    const int n = 4096;
+    std::vector<float> l(n), r(n);
+    size_t pos = 0;
+    bench("audio_data_read", "frame", [&](long iters) {
+      for (long it = 0; it < iters; ++it) {
+        audio.read(pos, l.data(), r.data(), n);
+        pos = (pos + n) % audio.numFrames();
+      }
+      g_sink = l[0];
+      return iters * n;
+    });
+  }
+  audio.close();
+  std::remove(path.c_str());
+}
+
+// Beam ------------------------------------------------------------------
+
+struct Sample {
+  float x, y;
+};
+
+// One XY frame at each beta, mapped and spaced as Oscilloscope does with
+// beta-coupled step distance
+void benchBeam(WorkerPool &pool) {
+  const int n = 1024;
+  const float w = 1280.0f, h = 720.0f;
+  const float scale = std::min(w, h) * 0.4f;
+  const float beam_size = 3.0f; // Oscilloscope's default
+  auto toPixel = [=](const Sample &s) -> Sample {
+    return {w * 0.5f + s.x * scale, h * 0.5f - s.y * scale};
+  };
+
+  for (double beta : {0.0, 1.0, 2.0, 4.0, 7.0, 10.0, 40.0}) {
+    TestSignalGenerator gen;
+    gen.setSampleRate(48000.0);
+    gen.setFrequency(80.0);
+    gen.setDetune(1.003);
+    gen.setBeta(beta);
+    std::vector<float> l(n), r(n);
+    gen.generate(l.data(), r.data(), n);
+    std::vector<Sample> samples(n);
+    for (int i = 0; i < n; ++i)
+      samples[i] = {l[i], r[i]};
+
+    BeamSplatter::Params params;
+    params.max_splats = kDesktopQuality.max_splats;
+    params.hue_dynamics = 0.05f;
+    const BetaDensity density = BetaDensity::lookup(beta, 1, 80.0, 48000.0);
+    params.step_dist =
+        BetaDensity::stepDist(density, scale, n, params.max_splats,
+                              kDesktopQuality.step_dist, beam_size);
+
+    char name[64];
+    std::vector<BeamSplat> splats;
+    for (int threaded = 0; threaded < 2; ++threaded) {
+      BeamSplatter splatter;
+      if (threaded)
+        splatter.setPool(&pool);
+      splatter.generate(samples.data(), n, toPixel, params, splats);
+      std::snprintf(name, sizeof(name), "beam_substeps_beta%g%s", beta,
+                    threaded ? "_pool" : "");
+      bench(name, "frame", [&](long iters) {
+        for (long it = 0; it < iters; ++it)
+          splatter.generate(samples.data(), n, toPixel, params, splats);
+        return iters;
+      }, static_cast<double>(splats.size()), "splats");
+    }
+
+    params.mode = BeamSplatter::Mode::Analytic;
+    params.beam_sigma = beam_size * 0.1767767f;
+    BeamSplatter splatter;
+    splatter.generate(samples.data(), n, toPixel, params, splats);
+    std::snprintf(name, sizeof(name), "beam_analytic_beta%g", beta);
+    bench(name, "frame", [&](long iters) {
+      for (long it = 0; it < iters; ++it)
+        splatter.generate(samples.data(), n, toPixel, params, splats);
+      return iters;
+    }, static_cast<double>(splats.size()), "splats");
+  }
+}
+
+void writeJson(int workers) {
+  std::printf("{\n  \"workers\": %d,\n  \"results\": [\n", workers);
+  for (size_t i = 0; i < g_results.size(); ++i) {
+    const Result &r = g_results[i];
+    std::printf("    {\"name\": \"%s\", \"unit\": \"ns/%s\", \"value\": %.3f",
+                r.name.c_str(), r.unit.c_str(), r.ns_per_item);
+    if (r.extra >= 0.0)
+      std::printf(", \"%s\": %.0f", r.extra_name.c_str(), r.extra);
+    std::printf("}%s\n", i + 1 < g_results.size() ? "," : "");
+  }
+  std::printf("  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int wav_seconds = 600; // A 10 minute track
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--quick") == 0) {
+      g_repeats = 2;
+      g_min_seconds = 0.01;
+      wav_seconds = 30;
+    } else {
+      std::fprintf(stderr, "usage: faveworm_bench [--quick] > results.json\n");
+      return 1;
+    }
+  }
+
+  WorkerPool pool(WorkerPool::defaultWorkers(7));
+
+  benchFilters();
+  benchOscillators();
+  benchAudioProcess("audio_process", 1, false);
+  benchAudioProcess("audio_process_os4", 4, false);
+  benchAudioProcess("audio_process_resampled", 1, true);
+  benchAudioData(wav_seconds);
+  benchBeam(pool);
+
+  writeJson(pool.concurrency() - 1);
+  return 0;
+}
@@ -0,0 +1,71 @@
+// QualityGovernor under sustained overload and recovery
+// Build: cmake -S . -B build -DFAVEWORM_BUILD_APP=OFF && cmake --build build
+// Run:   ctest --test-dir build (or quality_governor_test; exit 1 on failure)
+
+#include "QualityGovernor.h"
+
+#include <cstdio>
+
+namespace {
+
+int g_failures = 0;
+
+void check(bool ok, const char *profile, const char *what) {
+  if (!ok) {
+    std::fprintf(stderr, "FAIL %s: %s\n", profile, what);
+    ++g_failures;
+  }
+}
+
+// Frames at three times the CPU budget drive quality to the profile's floor,
+// which must step through reduced bloom down to the CRT bypass; idle frames
+// bring everything back
+void overloadAndRecover(const QualityProfile &profile, const char *name) {
+  QualityGovernor governor(profile);
+  const double budget = profile.target_ms;
+
+  for (int i = 0; i < 600; ++i)
+    governor.update(3.0 * budget, budget, 0.0);
+  check(governor.quality() == profile.min_quality, name,
+        "overload settles at the floor");
+  check(governor.bloomLevels() < profile.bloom_levels, name,
+        "overload reduces bloom");
+  check(governor.crtBypassed(), name, "overload bypasses the CRT pass");
+  check(governor.splatBudget() < profile.max_splats, name,
+        "overload scales the splat budget");
+
+  for (int i = 0; i < 2000; ++i)
+    governor.update(0.1 * budget, budget, 0.0);
+  check(governor.quality() == 1.0f, name, "headroom recovers full quality");
+  check(governor.bloomLevels() == profile.bloom_levels, name,
+        "headroom restores bloom");
+  check(!governor.crtBypassed(), name, "headroom restores the CRT pass");
+}
+
+// Long intervals with the CPU mostly idle are the display (30 Hz, a
+// throttled tab), not load: quality holds
+void slowDisplay(const QualityProfile &profile, const char *name) {
+  QualityGovernor governor(profile);
+  const double budget = profile.target_ms;
+
+  for (int i = 0; i < 600; ++i)
+    governor.update(0.1 * budget, 2.0 * budget, 0.0);
+  check(governor.quality() == 1.0f, name, "a slow display keeps quality");
+  check(!governor.crtBypassed(), name, "a slow display keeps the CRT pass");
+
+  for (int i = 0; i < 600; ++i)
+    governor.update(0.4 * budget, 2.0 * budget, 0.0);
+  check(governor.quality() < 1.0f, name, "busy long frames lower quality");
+}
+
+} // namespace
+
+int main() {
+  overloadAndRecover(kDesktopQuality, "desktop");
+  overloadAndRecover(kWebQuality, "web");
+  slowDisplay(kDesktopQuality, "desktop");
+  slowDisplay(kWebQuality, "web");
+  if (g_failures == 0)
+    std::fprintf(stderr, "quality_governor_test: all passed\n");
+  return g_failures == 0 ? 0 : 1;
+}